@@ -264,6 +264,8 @@ ifeq ($(OPENMSX_TARGET_OS),darwin)
 SOURCES_FULL+=$(foreach dir,$(SOURCE_DIRS),$(sort $(wildcard $(dir)/*.mm)))
 endif
 SOURCES_FULL:=$(filter-out %Test.cc,$(SOURCES_FULL))
+# The benchmarks are standalone programs, only built via Meson.
+SOURCES_FULL:=$(filter-out src/benchmark/%.cc,$(SOURCES_FULL))
 
 ifneq ($(COMPONENT_LASERDISC),true)
 SOURCES_FULL:=$(filter-out src/laserdisc/%.cc,$(SOURCES_FULL))
@@ -0,0 +1,261 @@
+#include "BinarySavestate.hh"
+
+#include "File.hh"
+#include "MSXException.hh"
+#include "MSXMotherBoard.hh"
+#include "Version.hh"
+#include "serialize.hh"
+
+#include "DeltaBlock.hh"
+#include "endian.hh"
+#include "lz4.hh"
+#include "narrow.hh"
+#include "ranges.hh"
+#include "xrange.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <deque>
+
+namespace openmsx::BinarySavestate {
+
+enum SectionType : uint32_t {
+	STATE = 0,
+	BLOB = 1,
+};
+static constexpr uint32_t FLAG_LZ4 = 1;
+
+static constexpr size_t HEADER_SIZE = 8 + 4 + 4 + 4; // excluding version string
+static constexpr size_t ENTRY_SIZE = 4 + 4 + 8 + 8 + 8;
+
+namespace {
+
+struct Section {
+	uint32_t type;
+	uint32_t flags;
+	uint64_t offset;
+	uint64_t storedSize;
+	uint64_t rawSize;
+};
+
+class Encoder
+{
+public:
+	explicit Encoder(size_t numSections_)
+		: numSections(numSections_)
+	{
+		auto version = Version::full();
+		tablePos = HEADER_SIZE + version.size();
+		out.resize(tablePos + numSections * ENTRY_SIZE); // table is filled in by add()
+		std::ranges::copy(MAGIC, out.data());
+		Endian::write_UA_L32(&out[ 8], FORMAT_VERSION);
+		Endian::write_UA_L32(&out[12], narrow<uint32_t>(numSections));
+		Endian::write_UA_L32(&out[16], narrow<uint32_t>(version.size()));
+		std::ranges::copy(version, &out[HEADER_SIZE]);
+	}
+
+	void add(SectionType type, std::span<const uint8_t> data)
+	{
+		assert(sectionIdx < numSections);
+		Section s{.type = type, .flags = 0, .offset = out.size(),
+		          .storedSize = data.size(), .rawSize = data.size()};
+		bool stored = false;
+		if (!data.empty() && (data.size() <= INT_MAX / 2)) {
+			out.resize(s.offset + LZ4::compressBound(int(data.size())));
+			auto compressedSize = size_t(LZ4::compress(data.data(), &out[s.offset], int(data.size())));
+			if (compressedSize < data.size()) { // only when it helps
+				s.flags |= FLAG_LZ4;
+				s.storedSize = compressedSize;
+				stored = true;
+			}
+		}
+		out.resize(s.offset + s.storedSize);
+		if (!stored) copy_to_range(data, std::span{&out[s.offset], data.size()});
+
+		auto* p = &out[tablePos + sectionIdx++ * ENTRY_SIZE];
+		Endian::write_UA_L32(p +  0, s.type);
+		Endian::write_UA_L32(p +  4, s.flags);
+		Endian::write_UA_L64(p +  8, s.offset);
+		Endian::write_UA_L64(p + 16, s.storedSize);
+		Endian::write_UA_L64(p + 24, s.rawSize);
+	}
+
+	[[nodiscard]] std::vector<uint8_t> finish() &&
+	{
+		assert(sectionIdx == numSections);
+		return std::move(out);
+	}
+
+private:
+	std::vector<uint8_t> out;
+	size_t numSections;
+	size_t sectionIdx = 0;
+	size_t tablePos;
+};
+
+[[nodiscard]] bool hasMagic(std::span<const uint8_t> data)
+{
+	return (data.size() >= MAGIC.size()) &&
+	       std::ranges::equal(data.first(MAGIC.size()), MAGIC,
+	                          [](uint8_t m, char c) { return m == uint8_t(c); });
+}
+
+} // namespace
+
+bool isBinarySavestate(const std::string& filename)
+{
+	try {
+		File file(filename);
+		if (file.getSize() < MAGIC.size()) return false;
+		std::array<uint8_t, MAGIC.size()> buf;
+		file.read(buf);
+		return hasMagic(buf);
+	} catch (MSXException&) {
+		return false;
+	}
+}
+
+std::vector<uint8_t> encode(std::span<const StateRef> states)
+{
+	size_t numSections = 0;
+	for (const auto& s : states) numSections += 1 + s.deltaBlocks.size();
+	Encoder encoder(numSections);
+
+	MemBuffer<uint8_t> blob;
+	for (const auto& s : states) {
+		encoder.add(STATE, s.buffer);
+		for (const auto& block : s.deltaBlocks) {
+			// Blocks can be stored as a difference with an earlier
+			// block, so always write the fully reconstructed data.
+			if (blob.size() != block->getSize()) blob = MemBuffer<uint8_t>(block->getSize());
+			block->apply(blob);
+			encoder.add(BLOB, blob);
+		}
+	}
+	return std::move(encoder).finish();
+}
+
+std::vector<State> decode(std::span<const uint8_t> data)
+{
+	auto invalid = [](std::string_view reason) {
+		return MSXException("Invalid binary savestate: ", reason);
+	};
+	if ((data.size() < HEADER_SIZE) || !hasMagic(data)) {
+		throw invalid("bad header");
+	}
+	if (auto formatVersion = Endian::read_UA_L32(&data[8]); formatVersion != FORMAT_VERSION) {
+		throw invalid(strCat("unsupported format version ", formatVersion));
+	}
+	size_t numSections = Endian::read_UA_L32(&data[12]);
+	size_t versionSize = Endian::read_UA_L32(&data[16]);
+	if ((data.size() - HEADER_SIZE) < versionSize) throw invalid("truncated header");
+	std::string_view version(std::bit_cast<const char*>(&data[HEADER_SIZE]), versionSize);
+	if (version != Version::full()) {
+		// The memory archives don't store class versions, so the
+		// layout can only be interpreted by the same openMSX build.
+		throw MSXException("Binary savestate was created by ", version,
+		                   ", it can only be loaded by that version.");
+	}
+	auto tablePos = HEADER_SIZE + versionSize;
+	if (((data.size() - tablePos) / ENTRY_SIZE) < numSections) throw invalid("truncated section table");
+
+	// Blobs with the same index in consecutive states are typically very
+	// similar (they're the same memory block at different moments), so
+	// store them as differences, like the reverse snapshots do.
+	LastDeltaBlocks lastDeltaBlocks;
+	std::deque<uint8_t> blobIds; // only the (stable) addresses are used, as ids
+	std::vector<State> result;
+	MemBuffer<uint8_t> blob;
+	size_t blobIdx = 0;
+	for (auto i : xrange(numSections)) {
+		const auto* p = &data[tablePos + i * ENTRY_SIZE];
+		Section s{.type       = Endian::read_UA_L32(p +  0),
+		          .flags      = Endian::read_UA_L32(p +  4),
+		          .offset     = Endian::read_UA_L64(p +  8),
+		          .storedSize = Endian::read_UA_L64(p + 16),
+		          .rawSize    = Endian::read_UA_L64(p + 24)};
+		if ((s.offset > data.size()) || (s.storedSize > (data.size() - s.offset))) {
+			throw invalid("section out of bounds");
+		}
+		if (((s.flags & FLAG_LZ4) ? (s.rawSize / 256) : s.rawSize) > s.storedSize) {
+			// LZ4 can't compress better than this, check before allocating
+			throw invalid("section size mismatch");
+		}
+		auto stored = data.subspan(s.offset, s.storedSize);
+
+		auto decodeSection = [&](std::span<uint8_t> dst) {
+			if (s.flags & FLAG_LZ4) {
+				if ((stored.size() > INT_MAX) || (dst.size() > INT_MAX) ||
+				    (LZ4::decompressSafe(stored.data(), dst.data(), int(stored.size()), int(dst.size()))
+				     != int(dst.size()))) {
+					throw invalid("corrupt compressed data");
+				}
+			} else {
+				if (stored.size() != dst.size()) throw invalid("section size mismatch");
+				copy_to_range(stored, dst);
+			}
+		};
+
+		if (s.type == STATE) {
+			auto& state = result.emplace_back();
+			state.buffer = MemBuffer<uint8_t>(s.rawSize);
+			decodeSection(state.buffer);
+			blobIdx = 0;
+		} else if (s.type == BLOB) {
+			if (result.empty()) throw invalid("memory block without state");
+			if (blob.size() != s.rawSize) blob = MemBuffer<uint8_t>(s.rawSize);
+			decodeSection(blob);
+			if (blobIdx == blobIds.size()) blobIds.emplace_back();
+			result.back().deltaBlocks.push_back(
+				lastDeltaBlocks.createNew(&blobIds[blobIdx], blob));
+			++blobIdx;
+		} else {
+			throw invalid(strCat("unknown section type ", s.type));
+		}
+	}
+	if (result.empty()) throw invalid("no state");
+	return result;
+}
+
+void save(const std::string& filename, std::span<const StateRef> states)
+{
+	auto data = encode(states);
+	File file(filename, File::OpenMode::TRUNCATE);
+	file.write(data);
+}
+
+std::vector<State> load(const std::string& filename)
+{
+	File file(filename);
+	auto mapping = file.mmap<const uint8_t>();
+	return decode(std::span{mapping.data(), mapping.size()});
+}
+
+void saveMachine(const std::string& filename, const MSXMotherBoard& board)
+{
+	LastDeltaBlocks lastDeltaBlocks;
+	std::vector<std::shared_ptr<DeltaBlock>> deltaBlocks;
+	MemOutputArchive out(lastDeltaBlocks, deltaBlocks, false);
+	out.serialize("machine", board);
+	auto buffer = std::move(out).releaseBuffer();
+	std::array states = {StateRef{.buffer = buffer, .deltaBlocks = deltaBlocks}};
+	save(filename, states);
+}
+
+void loadMachine(const std::string& filename, MSXMotherBoard& board)
+{
+	if (isBinarySavestate(filename)) {
+		auto states = load(filename);
+		if (states.size() != 1) {
+			throw MSXException("Binary savestate ", filename, " contains more than one state");
+		}
+		MemInputArchive in(states[0].buffer, states[0].deltaBlocks);
+		in.serialize("machine", board);
+	} else {
+		XmlInputArchive in(filename);
+		in.serialize("machine", board);
+	}
+}
+
+} // namespace openmsx::BinarySavestate
@@ -0,0 +1,88 @@
+#ifndef BINARYSAVESTATE_HH
+#define BINARYSAVESTATE_HH
+
+#include "MemBuffer.hh"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace openmsx {
+
+class DeltaBlock;
+class MSXMotherBoard;
+
+/** Binary container for savestates in the MemOutputArchive format.
+  *
+  * Compared to the XML format (XmlOutputArchive) this is a lot faster to
+  * save and load: memory blocks are stored as-is (or LZ4 compressed) instead
+  * of being converted to text and gzipped. The downside is that the
+  * MemOutputArchive format doesn't store class versions, so such a file can
+  * only be loaded by the same openMSX version that created it.
+  *
+  * File format (all values little endian):
+  *   header:  the 8 bytes MAGIC, uint32 FORMAT_VERSION, uint32 number of
+  *            sections, uint32 length of the openMSX version string, the
+  *            version string itself
+  *   table:   per section: uint32 type, uint32 flags, uint64 file offset,
+  *            uint64 stored size, uint64 original size
+  *   data:    the content of the sections
+  * A STATE section contains a MemOutputArchive buffer. It's followed by one
+  * BLOB section per delta block of that state (in order). Flag bit 0
+  * indicates LZ4 compressed data.
+  */
+namespace BinarySavestate {
+
+inline constexpr std::array<char, 8> MAGIC = {'O', 'M', 'S', 'X', 'B', 'I', 'N', 'S'};
+inline constexpr uint32_t FORMAT_VERSION = 1;
+
+struct StateRef {
+	std::span<const uint8_t> buffer;
+	std::span<const std::shared_ptr<DeltaBlock>> deltaBlocks;
+};
+struct State {
+	MemBuffer<uint8_t> buffer;
+	std::vector<std::shared_ptr<DeltaBlock>> deltaBlocks;
+};
+
+/** Does the given file start with the MAGIC header? False when the file
+  * can't be read.
+  */
+[[nodiscard]] bool isBinarySavestate(const std::string& filename);
+
+/** Encode the given states in the format described above. */
+[[nodiscard]] std::vector<uint8_t> encode(std::span<const StateRef> states);
+
+/** Decode data produced by encode().
+  * @throws MSXException on invalid data or data created by a different
+  *         openMSX version.
+  */
+[[nodiscard]] std::vector<State> decode(std::span<const uint8_t> data);
+
+/** Write the given states to a file.
+  * @throws MSXException on write errors.
+  */
+void save(const std::string& filename, std::span<const StateRef> states);
+
+/** Read all states from a file.
+  * @throws MSXException on read errors, an invalid file or a file created
+  *         by a different openMSX version.
+  */
+[[nodiscard]] std::vector<State> load(const std::string& filename);
+
+/** Save the state of a machine in this binary format. */
+void saveMachine(const std::string& filename, const MSXMotherBoard& board);
+
+/** Load a machine state from file, this can either be a binary or an XML
+  * savestate.
+  * @throws MSXException (or XMLException) on errors.
+  */
+void loadMachine(const std::string& filename, MSXMotherBoard& board);
+
+} // namespace BinarySavestate
+} // namespace openmsx
+
+#endif
@@ -14,6 +14,7 @@
 #include "RomInfo.hh"
 #include "SettingsConfig.hh"
 #include "StdioMessages.hh"
+#include "TclObject.hh"
 #include "Version.hh"
 #include "XMLException.hh"
 
@@ -63,6 +64,7 @@ CommandLineParser::CommandLineParser(Reactor& reactor_)
 	registerOption("-script",     scriptOption,  BEFORE_SETTINGS, 1); // correct phase?
 	registerOption("-command",    commandOption, BEFORE_SETTINGS, 1); // same phase as -script
 	registerOption("-testconfig", testConfigOption, BEFORE_SETTINGS, 1);
+	registerOption("-bench",      benchOption,   BEFORE_SETTINGS, 1); // same phase as -command
 
 	registerOption("-machine",    machineOption, LOAD_MACHINE);
 	registerOption("-setup",      setupOption,   LOAD_MACHINE);
@@ -614,6 +616,24 @@ std::string_view CommandLineParser::TestConfigOption::optionHelp() const
 	return "Test if the specified config works and exit";
 }
 
+// class BenchOption
+
+void CommandLineParser::BenchOption::parseOption(
+	const std::string& option, std::span<std::string>& cmdLine)
+{
+	auto& parser = OUTER(CommandLineParser, benchOption);
+	auto seconds = getArgument(option, cmdLine);
+	// the 'benchmark' command does the actual work (and checks the argument)
+	parser.commandOption.commands.push_back(std::string(
+		makeTclList("benchmark", "-exit", seconds).getString()));
+}
+
+std::string_view CommandLineParser::BenchOption::optionHelp() const
+{
+	return "Emulate the given number of seconds headless and unthrottled, "
+	       "report the speed and exit";
+}
+
 // class BashOption
 
 void CommandLineParser::BashOption::parseOption(
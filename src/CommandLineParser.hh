@@ -146,6 +146,11 @@ private:
 		[[nodiscard]] std::string_view optionHelp() const override;
 	} testConfigOption;
 
+	struct BenchOption final : CLIOption {
+		void parseOption(const std::string& option, std::span<std::string>& cmdLine) override;
+		[[nodiscard]] std::string_view optionHelp() const override;
+	} benchOption;
+
 	struct BashOption final : CLIOption {
 		void parseOption(const std::string& option, std::span<std::string>& cmdLine) override;
 		[[nodiscard]] std::string_view optionHelp() const override;
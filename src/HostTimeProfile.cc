@@ -0,0 +1,63 @@
+#include "HostTimeProfile.hh"
+
+#include <chrono>
+
+namespace openmsx {
+
+[[nodiscard]] static uint64_t now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void HostTimeProfile::start()
+{
+	totals = {};
+	current = Category::OTHER;
+	last = now();
+	running = true;
+}
+
+HostTimeProfile::Totals HostTimeProfile::stop()
+{
+	if (running) {
+		account();
+		running = false;
+	}
+	return totals;
+}
+
+std::string_view HostTimeProfile::getName(Category category)
+{
+	using namespace std::literals;
+	static constexpr std::array<std::string_view, NUM> names = {
+		"other"sv, "cpu"sv, "vdp_render"sv, "vdp_cmd"sv,
+		"sound"sv, "scheduler"sv, "tcl"sv,
+	};
+	return names[size_t(category)];
+}
+
+void HostTimeProfile::account()
+{
+	auto t = now();
+	totals[size_t(current)] += t - last;
+	last = t;
+}
+
+HostTimeProfile::Category HostTimeProfile::enter(Category category)
+{
+	account();
+	auto prev = current;
+	current = category;
+	return prev;
+}
+
+void HostTimeProfile::leave(Category prev)
+{
+	// The measurement may have been stopped (or restarted) in between.
+	if (!running) return;
+	account();
+	current = prev;
+}
+
+} // namespace openmsx
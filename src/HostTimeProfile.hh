@@ -0,0 +1,73 @@
+#ifndef HOSTTIMEPROFILE_HH
+#define HOSTTIMEPROFILE_HH
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace openmsx {
+
+/** Measures how the host time is divided over the main emulation subsystems,
+  * used by the 'benchmark' command.
+  *
+  * Time is attributed to the innermost active Scope, so the categories are
+  * exclusive: e.g. a sound update triggered from within the CPU emulation
+  * counts as 'sound', not as 'cpu'. Time outside any Scope (event handling,
+  * sleeping, ...) counts as 'other'. This is only used from the main thread.
+  * When not running, a Scope costs a single (well predicted) branch.
+  */
+class HostTimeProfile
+{
+public:
+	enum class Category : uint8_t {
+		OTHER, CPU, VDP_RENDER, VDP_CMD, SOUND, SCHEDULER, TCL,
+		NUM // must be last
+	};
+	static constexpr auto NUM = size_t(Category::NUM);
+	using Totals = std::array<uint64_t, NUM>; // in nanoseconds
+
+	/** Start a new measurement, all totals are reset. */
+	static void start();
+	/** Stop measuring, returns the totals of the measurement. */
+	static Totals stop();
+	[[nodiscard]] static bool isRunning() { return running; }
+
+	[[nodiscard]] static std::string_view getName(Category category);
+
+	class Scope
+	{
+	public:
+		explicit Scope(Category category) {
+			if (running) [[unlikely]] {
+				prev = enter(category);
+				active = true;
+			}
+		}
+		~Scope() {
+			if (active) [[unlikely]] leave(prev);
+		}
+		Scope(const Scope&) = delete;
+		Scope(Scope&&) = delete;
+		Scope& operator=(const Scope&) = delete;
+		Scope& operator=(Scope&&) = delete;
+
+	private:
+		Category prev = Category::OTHER;
+		bool active = false;
+	};
+
+private:
+	static Category enter(Category category);
+	static void leave(Category prev);
+	static void account();
+
+private:
+	static inline bool running = false;
+	static inline Category current = Category::OTHER;
+	static inline uint64_t last = 0;
+	static inline Totals totals = {};
+};
+
+} // namespace openmsx
+
+#endif
@@ -422,6 +422,20 @@ byte MSXDevice::peekIO(uint16_t /*port*/, EmuTime /*time*/) const
 	return 0xFF;
 }
 
+MSXDevice::ReadIOFunc MSXDevice::getReadIOFunc() const
+{
+	return [](MSXDevice& device, uint16_t port, EmuTime time) {
+		return device.readIO(port, time);
+	};
+}
+
+MSXDevice::WriteIOFunc MSXDevice::getWriteIOFunc() const
+{
+	return [](MSXDevice& device, uint16_t port, byte value, EmuTime time) {
+		device.writeIO(port, value, time);
+	};
+}
+
 
 byte MSXDevice::readMem(uint16_t /*address*/, EmuTime /*time*/)
 {
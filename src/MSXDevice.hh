@@ -141,6 +141,30 @@ public:
 	 */
 	[[nodiscard]] virtual byte peekIO(uint16_t port, EmuTime time) const;
 
+	/**
+	 * Non-virtual entry points for readIO() and writeIO(). MSXCPUInterface
+	 * calls these (with this device as first parameter) for IN and OUT
+	 * instructions. The default implementations call the virtual methods.
+	 * Devices with a lot of IO traffic (e.g. VDP, PSG) can return
+	 * 'readIOThunk<Derived>' / 'writeIOThunk<Derived>' (instantiated in
+	 * their own translation unit), so that their implementation can be
+	 * inlined in the entry point. Wrapper devices (e.g. for IO
+	 * watchpoints) must keep the default.
+	 */
+	using ReadIOFunc  = byte (*)(MSXDevice& device, uint16_t port, EmuTime time);
+	using WriteIOFunc = void (*)(MSXDevice& device, uint16_t port, byte value, EmuTime time);
+	[[nodiscard]] virtual ReadIOFunc  getReadIOFunc()  const;
+	[[nodiscard]] virtual WriteIOFunc getWriteIOFunc() const;
+
+	template<typename Derived>
+	static byte readIOThunk(MSXDevice& device, uint16_t port, EmuTime time) {
+		return static_cast<Derived&>(device).Derived::readIO(port, time);
+	}
+	template<typename Derived>
+	static void writeIOThunk(MSXDevice& device, uint16_t port, byte value, EmuTime time) {
+		static_cast<Derived&>(device).Derived::writeIO(port, value, time);
+	}
+
 
 	// Memory
 
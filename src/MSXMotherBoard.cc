@@ -9,12 +9,15 @@
 #include "Debugger.hh"
 #include "DeviceFactory.hh"
 #include "EventDelay.hh"
+#include "Event.hh"
 #include "EventDistributor.hh"
 #include "FileException.hh"
 #include "FileOperations.hh"
 #include "GlobalCliComm.hh"
+#include "GlobalCommandController.hh"
 #include "GlobalSettings.hh"
 #include "HardwareConfig.hh"
+#include "HostTimeProfile.hh"
 #include "InfoTopic.hh"
 #include "JoystickPort.hh"
 #include "LedStatus.hh"
@@ -37,9 +40,12 @@
 #include "ReverseManager.hh"
 #include "Schedulable.hh"
 #include "Scheduler.hh"
+#include "SettingsManager.hh"
 #include "SimpleDebuggable.hh"
 #include "StateChangeDistributor.hh"
+#include "TclArgParser.hh"
 #include "TclObject.hh"
+#include "Timer.hh"
 #include "XMLElement.hh"
 #include "serialize.hh"
 #include "serialize_stl.hh"
@@ -48,6 +54,7 @@
 #include "one_of.hh"
 #include "stl.hh"
 #include "unreachable.hh"
+#include "xrange.hh"
 
 #include <algorithm>
 #include <cassert>
@@ -126,6 +133,17 @@ private:
 	MSXMotherBoard& motherBoard;
 };
 
+class SyncPointStatsCmd final : public Command
+{
+public:
+	explicit SyncPointStatsCmd(MSXMotherBoard& motherBoard);
+	void execute(std::span<const TclObject> tokens, TclObject& result) override;
+	[[nodiscard]] std::string help(std::span<const TclObject> tokens) const override;
+	void tabCompletion(std::vector<std::string>& tokens) const override;
+private:
+	MSXMotherBoard& motherBoard;
+};
+
 class MachineNameInfo final : public InfoTopic
 {
 public:
@@ -172,6 +190,42 @@ private:
 	MSXMotherBoard& motherBoard;
 };
 
+class BenchmarkCmd final : public Command, private Schedulable
+{
+public:
+	explicit BenchmarkCmd(MSXMotherBoard& motherBoard);
+	BenchmarkCmd(const BenchmarkCmd&) = delete;
+	BenchmarkCmd(BenchmarkCmd&&) = delete;
+	BenchmarkCmd& operator=(const BenchmarkCmd&) = delete;
+	BenchmarkCmd& operator=(BenchmarkCmd&&) = delete;
+	~BenchmarkCmd();
+
+	void execute(std::span<const TclObject> tokens, TclObject& result) override;
+	[[nodiscard]] std::string help(std::span<const TclObject> tokens) const override;
+	void tabCompletion(std::vector<std::string>& tokens) const override;
+private:
+	void executeUntil(EmuTime time) override;
+	void changeSetting(std::string_view name, std::string_view value);
+	void restoreSettings();
+
+	MSXMotherBoard& motherBoard;
+	std::vector<std::pair<std::string, TclObject>> savedSettings;
+	TclObject lastResult;
+	EmuTime startTime = EmuTime::zero();
+	uint64_t startRealTime = 0; // in us
+	bool exitWhenDone = false;
+};
+
+class SkipAheadCmd final : public Command
+{
+public:
+	explicit SkipAheadCmd(MSXMotherBoard& motherBoard);
+	void execute(std::span<const TclObject> tokens, TclObject& result) override;
+	[[nodiscard]] std::string help(std::span<const TclObject> tokens) const override;
+private:
+	MSXMotherBoard& motherBoard;
+};
+
 class DeviceInfo final : public InfoTopic
 {
 public:
@@ -234,6 +288,13 @@ MSXMotherBoard::MSXMotherBoard(Reactor& reactor_)
 		"of which you don't want to see warning messages about blank "
 		"SRAM content or PSG port directions for instance.",
 		false, Setting::Save::NO)
+	, runInBackgroundSetting(*msxCommandController, "run_in_background",
+		"Keep emulating this machine while another machine is active. "
+		"Intended for scripts that run many machines at once, e.g. for "
+		"automated testing. Such machines run as fast as possible and "
+		"without sound. All machines take turns on the same thread, so "
+		"this doesn't use additional CPU cores.",
+		false, Setting::Save::NO)
 	, fastForwardHelper(std::make_unique<FastForwardHelper>(*this))
 	, settingObserver(std::make_unique<SettingObserver>(*this))
 	, powerSetting(reactor.getGlobalSettings().getPowerSetting())
@@ -246,6 +307,9 @@ MSXMotherBoard::MSXMotherBoard(Reactor& reactor_)
 	extCommand = std::make_unique<ExtCmd>(*this, "ext");
 	removeExtCommand = std::make_unique<RemoveExtCmd>(*this);
 	storeSetupCommand = std::make_unique<StoreSetupCmd>(*this);
+	syncPointStatsCommand = std::make_unique<SyncPointStatsCmd>(*this);
+	benchmarkCommand = std::make_unique<BenchmarkCmd>(*this);
+	skipAheadCommand = std::make_unique<SkipAheadCmd>(*this);
 	machineNameInfo = std::make_unique<MachineNameInfo>(*this);
 	machineTypeInfo = std::make_unique<MachineTypeInfo>(*this);
 	machineExtensionInfo = std::make_unique<MachineExtensionInfo>(*this);
@@ -270,10 +334,12 @@ MSXMotherBoard::MSXMotherBoard(Reactor& reactor_)
 
 	powerSetting.attach(*settingObserver);
 	suppressMessagesSetting.attach(*settingObserver);
+	runInBackgroundSetting.attach(*settingObserver);
 }
 
 MSXMotherBoard::~MSXMotherBoard()
 {
+	runInBackgroundSetting.detach(*settingObserver);
 	suppressMessagesSetting.detach(*settingObserver);
 	powerSetting.detach(*settingObserver);
 	deleteMachine();
@@ -622,10 +688,29 @@ bool MSXMotherBoard::execute()
 	}
 	assert(getMachineConfig()); // otherwise powered cannot be true
 
+	if (pendingSkip != EmuDuration::zero()) [[unlikely]] {
+		// Same as in ReverseManager::goTo(): only render the last
+		// two frames (approximately, assuming PAL).
+		static constexpr double dur2frames = 2.0 * (313.0 * 1368.0) / (3579545.0 * 6.0);
+		auto preDelta = std::min(pendingSkip, EmuDuration::sec(dur2frames));
+		auto target = getCurrentTime() + pendingSkip;
+		pendingSkip = EmuDuration::zero();
+		fastForward(target - preDelta, true);
+		fastForward(target, false);
+		return true;
+	}
+
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::CPU);
 	getCPU().execute(false);
 	return true;
 }
 
+void MSXMotherBoard::skipAhead(EmuDuration duration)
+{
+	pendingSkip = duration;
+	exitCPULoopSync();
+}
+
 void MSXMotherBoard::fastForward(EmuTime time, bool fast)
 {
 	assert(powered);
@@ -750,11 +835,28 @@ void MSXMotherBoard::activate(bool active_)
 	auto event = active ? Event(MachineActivatedEvent())
 	                    : Event(MachineDeactivatedEvent());
 	msxEventDistributor->distributeEvent(event, scheduler->getCurrentTime());
+	updateBackground();
 	if (active) {
 		realTime->resync();
 	}
 }
 
+void MSXMotherBoard::updateBackground()
+{
+	bool newBackground = !active && runInBackgroundSetting.getBoolean();
+	if (newBackground == inBackground) return;
+	inBackground = newBackground;
+	// Only the active machine synchronizes with real time and produces
+	// sound (similar to fast-forwarding).
+	if (inBackground) {
+		realTime->disable();
+		msxMixer->mute();
+	} else {
+		msxMixer->unmute();
+		realTime->enable();
+	}
+}
+
 void MSXMotherBoard::exitCPULoopAsync()
 {
 	if (getMachineConfig()) {
@@ -1089,6 +1191,228 @@ void StoreSetupCmd::tabCompletion(std::vector<std::string>& tokens) const
 }
 
 
+// SyncPointStatsCmd
+
+SyncPointStatsCmd::SyncPointStatsCmd(MSXMotherBoard& motherBoard_)
+	: Command(motherBoard_.getCommandController(), "sync_point_stats")
+	, motherBoard(motherBoard_)
+{
+}
+
+void SyncPointStatsCmd::execute(std::span<const TclObject> tokens, TclObject& result)
+{
+	checkNumArgs(tokens, Between{1, 2}, "?reset?");
+	auto& scheduler = motherBoard.getScheduler();
+	if (tokens.size() == 2) {
+		if (tokens[1].getString() != "reset") throw SyntaxError();
+		scheduler.resetStats();
+		return;
+	}
+
+	auto seconds = (scheduler.getCurrentTime() - scheduler.getStatsStartTime()).toDouble();
+	for (const auto& stats : scheduler.getStats()) {
+		if (stats.scheduled == 0 && stats.executed == 0) continue;
+		result.addListElement(TclObject(TclObject::MakeDictTag{},
+			"device", stats.name,
+			"instances", stats.instances,
+			"scheduled", strCat(stats.scheduled),
+			"executed", strCat(stats.executed),
+			"per_second", (seconds > 0.0) ? (double(stats.executed) / seconds) : 0.0));
+	}
+}
+
+std::string SyncPointStatsCmd::help(std::span<const TclObject> /*tokens*/) const
+{
+	return "sync_point_stats        For each type of device (more precisely each type of\n"
+	       "                        Schedulable), show how many sync points were scheduled\n"
+	       "                        and executed, and the executed ones per emulated second.\n"
+	       "                        Each executed sync point interrupts the CPU emulation.\n"
+	       "sync_point_stats reset  Restart counting from the current emulated time.";
+}
+
+void SyncPointStatsCmd::tabCompletion(std::vector<std::string>& tokens) const
+{
+	using namespace std::literals;
+	static constexpr std::array options = {"reset"sv};
+	completeString(tokens, options);
+}
+
+
+// BenchmarkCmd
+
+BenchmarkCmd::BenchmarkCmd(MSXMotherBoard& motherBoard_)
+	: Command(motherBoard_.getCommandController(), "benchmark")
+	, Schedulable(motherBoard_.getScheduler())
+	, motherBoard(motherBoard_)
+{
+}
+
+BenchmarkCmd::~BenchmarkCmd()
+{
+	if (pendingSyncPoint()) {
+		// machine deleted before the benchmark finished
+		HostTimeProfile::stop();
+		restoreSettings();
+	}
+}
+
+void BenchmarkCmd::changeSetting(std::string_view name, std::string_view value)
+{
+	auto& settingsManager = motherBoard.getReactor().getGlobalCommandController().getSettingsManager();
+	auto* setting = settingsManager.findSetting(name);
+	if (!setting) return;
+	auto oldValue = setting->getValue();
+	if (oldValue.getString() == value) return;
+	setting->setValue(TclObject(value));
+	savedSettings.emplace_back(std::string(name), std::move(oldValue));
+}
+
+void BenchmarkCmd::restoreSettings()
+{
+	auto& settingsManager = motherBoard.getReactor().getGlobalCommandController().getSettingsManager();
+	for (const auto& [name, value] : std::views::reverse(savedSettings)) {
+		auto* setting = settingsManager.findSetting(name);
+		// The renderer starts in the special 'uninitialized' state which
+		// can't be set again. When exiting there's no need to open a
+		// window anyway.
+		if (!setting || (value.getString() == "uninitialized")) continue;
+		try {
+			setting->setValue(value);
+		} catch (MSXException& e) {
+			motherBoard.getMSXCliComm().printWarning(
+				"Couldn't restore setting ", name, ": ", e.getMessage());
+		}
+	}
+	savedSettings.clear();
+}
+
+void BenchmarkCmd::execute(std::span<const TclObject> tokens, TclObject& result)
+{
+	if (tokens.size() == 1) {
+		result = lastResult;
+		return;
+	}
+	bool exitFlag = false;
+	bool keepOutput = false;
+	std::array info = {
+		flagArg("-exit", exitFlag),
+		flagArg("-keep_output", keepOutput),
+	};
+	auto arguments = parseTclArgs(getInterpreter(), tokens.subspan(1), info);
+	if (arguments.size() != 1) throw SyntaxError();
+	auto seconds = arguments[0].getDouble(getInterpreter());
+	if (seconds <= 0.0) {
+		throw CommandException("Duration must be positive");
+	}
+	if (pendingSyncPoint()) {
+		throw CommandException("A benchmark is already running");
+	}
+
+	changeSetting("throttle", "off");
+	if (!keepOutput) {
+		changeSetting("renderer", "none");
+		changeSetting("sound_driver", "null");
+	}
+	exitWhenDone = exitFlag;
+	lastResult = TclObject();
+	startTime = getCurrentTime();
+	setSyncPoint(startTime + EmuDuration::sec(seconds));
+	startRealTime = Timer::getTime();
+	HostTimeProfile::start();
+}
+
+void BenchmarkCmd::executeUntil(EmuTime time)
+{
+	auto totals = HostTimeProfile::stop();
+	auto realSeconds = double(Timer::getTime() - startRealTime) / 1'000'000.0;
+	auto emuSeconds = (time - startTime).toDouble();
+	auto ratio = (realSeconds > 0.0) ? (emuSeconds / realSeconds) : 0.0;
+	restoreSettings();
+
+	uint64_t sum = 0;
+	for (auto t : totals) sum += t;
+
+	lastResult = TclObject(TclObject::MakeDictTag{},
+		"emulated_seconds", emuSeconds,
+		"real_seconds", realSeconds,
+		"speed_ratio", ratio);
+	auto report = strCat("benchmark: ", emuSeconds, " emulated seconds in ",
+	                     realSeconds, " real seconds, speed ratio ", ratio, '\n',
+	                     "  subsystem        ms      %");
+	for (auto i : xrange(HostTimeProfile::NUM)) {
+		auto name = HostTimeProfile::getName(HostTimeProfile::Category(i));
+		auto seconds = double(totals[i]) / 1'000'000'000.0;
+		lastResult.addDictKeyValue(name, seconds);
+		auto permille = sum ? ((totals[i] * 1000 + sum / 2) / sum) : 0;
+		strAppend(report, "\n  ", name, spaces(12 - name.size()),
+		          dec_string<7>(totals[i] / 1'000'000),
+		          "  ", dec_string<3>(permille / 10), '.', char('0' + permille % 10));
+	}
+	motherBoard.getMSXCliComm().printInfo(report);
+
+	if (exitWhenDone) {
+		exitCode = 0;
+		motherBoard.getReactor().getEventDistributor().distributeEvent(QuitEvent());
+	} else {
+		motherBoard.exitCPULoopSync();
+	}
+}
+
+std::string BenchmarkCmd::help(std::span<const TclObject> /*tokens*/) const
+{
+	return "benchmark [-exit] [-keep_output] <seconds>\n"
+	       "  Emulate the given number of seconds as fast as possible, then report\n"
+	       "  the emulated-to-real speed ratio and how the host time was divided\n"
+	       "  over CPU, VDP rendering, VDP commands, sound generation, the\n"
+	       "  scheduler (all other sync points) and Tcl callbacks. Time in a\n"
+	       "  subsystem triggered from within another one is only counted once.\n"
+	       "  Unless -keep_output is given, the 'none' renderer and the 'null'\n"
+	       "  sound driver are used. Throttling is disabled. The changed\n"
+	       "  settings are restored afterwards. With -exit openMSX quits when\n"
+	       "  the benchmark is done.\n"
+	       "benchmark\n"
+	       "  Return the result of the last benchmark as a dict.\n";
+}
+
+void BenchmarkCmd::tabCompletion(std::vector<std::string>& tokens) const
+{
+	using namespace std::literals;
+	static constexpr std::array options = {"-exit"sv, "-keep_output"sv};
+	completeString(tokens, options);
+}
+
+
+// SkipAheadCmd
+
+SkipAheadCmd::SkipAheadCmd(MSXMotherBoard& motherBoard_)
+	: Command(motherBoard_.getCommandController(), "skip_ahead")
+	, motherBoard(motherBoard_)
+{
+}
+
+void SkipAheadCmd::execute(std::span<const TclObject> tokens, TclObject& /*result*/)
+{
+	checkNumArgs(tokens, 2, "seconds");
+	auto seconds = tokens[1].getDouble(getInterpreter());
+	if (seconds <= 0.0) {
+		throw CommandException("Duration must be positive");
+	}
+	if (!motherBoard.isPowered()) {
+		throw CommandException("Machine is not powered on");
+	}
+	motherBoard.skipAhead(EmuDuration::sec(seconds));
+}
+
+std::string SkipAheadCmd::help(std::span<const TclObject> /*tokens*/) const
+{
+	return "skip_ahead <seconds>\n"
+	       "  Emulate the given number of seconds as fast as possible, e.g. to\n"
+	       "  skip a long intro or loading time. During this time no sound and\n"
+	       "  no video (except for the last two frames) is produced, and\n"
+	       "  openMSX doesn't respond to input.\n";
+}
+
+
 // MachineNameInfo
 
 MachineNameInfo::MachineNameInfo(MSXMotherBoard& motherBoard_)
@@ -1322,6 +1646,8 @@ void SettingObserver::update(const Setting& setting) noexcept
 		}
 	} else if (&setting == &motherBoard.suppressMessagesSetting) {
 		motherBoard.msxCliComm->setSuppressMessages(motherBoard.suppressMessagesSetting.getBoolean());
+	} else if (&setting == &motherBoard.runInBackgroundSetting) {
+		motherBoard.updateBackground();
 	} else {
 		UNREACHABLE;
 	}
@@ -19,6 +19,8 @@
 namespace openmsx {
 
 class AddRemoveUpdate;
+class BenchmarkCmd;
+class SkipAheadCmd;
 class CartridgeSlotManager;
 class CassettePortInterface;
 class CommandController;
@@ -56,6 +58,7 @@ class RemoveExtCmd;
 class RenShaTurbo;
 class ResetCmd;
 class StoreSetupCmd;
+class SyncPointStatsCmd;
 class ReverseManager;
 class SettingObserver;
 class Scheduler;
@@ -115,9 +118,18 @@ public:
 	[[nodiscard]] bool execute();
 
 	/** Run emulation until a certain time in fast forward mode.
+	 * @param fast When true, no video or sound output is produced, only
+	 *   the emulated state is advanced (see isFastForwarding()).
 	 */
 	void fastForward(EmuTime time, bool fast);
 
+	/** Skip the given amount of emulated time as fast as possible, only
+	 * the last two frames produce video output. Because this can't be
+	 * done from within the CPU emulation loop, it's postponed till the
+	 * next call to execute().
+	 */
+	void skipAhead(EmuDuration duration);
+
 	/** See CPU::exitCPULoopAsync(). */
 	void exitCPULoopAsync();
 	void exitCPULoopSync();
@@ -135,6 +147,10 @@ public:
 	void doReset();
 	void activate(bool active);
 	[[nodiscard]] bool isActive() const { return active; }
+	/** Should this machine be emulated while it's not the active machine?
+	  * Such machines run unthrottled and without sound output.
+	  */
+	[[nodiscard]] bool isRunningInBackground() const { return inBackground; }
 	[[nodiscard]] bool isFastForwarding() const { return fastForwarding; }
 
 	[[nodiscard]] uint8_t readIRQVector() const;
@@ -181,6 +197,7 @@ public:
 	[[nodiscard]] Reactor& getReactor() { return reactor; }
 	[[nodiscard]] VideoSourceSetting& getVideoSource() { return videoSourceSetting; }
 	[[nodiscard]] BooleanSetting& suppressMessages() { return suppressMessagesSetting; }
+	[[nodiscard]] BooleanSetting& runInBackground() { return runInBackgroundSetting; }
 
 	// convenience methods
 	[[nodiscard]] CommandController& getCommandController();
@@ -274,6 +291,7 @@ public:
 
 private:
 	void deleteMachine();
+	void updateBackground();
 
 private:
 	Reactor& reactor;
@@ -324,6 +342,7 @@ private:
 	std::unique_ptr<LedStatus> ledStatus;
 	VideoSourceSetting videoSourceSetting;
 	BooleanSetting suppressMessagesSetting;
+	BooleanSetting runInBackgroundSetting;
 
 	std::unique_ptr<CartridgeSlotManager> slotManager;
 	std::unique_ptr<ReverseManager> reverseManager;
@@ -333,6 +352,9 @@ private:
 	std::unique_ptr<ExtCmd>       extCommand;
 	std::unique_ptr<RemoveExtCmd> removeExtCommand;
 	std::unique_ptr<StoreSetupCmd> storeSetupCommand;
+	std::unique_ptr<SyncPointStatsCmd> syncPointStatsCommand;
+	std::unique_ptr<BenchmarkCmd> benchmarkCommand;
+	std::unique_ptr<SkipAheadCmd> skipAheadCommand;
 	std::unique_ptr<MachineNameInfo> machineNameInfo;
 	std::unique_ptr<MachineTypeInfo> machineTypeInfo;
 	std::unique_ptr<MachineExtensionInfo> machineExtensionInfo;
@@ -347,8 +369,11 @@ private:
 
 	std::vector<Keyboard*> keyboards; // typically contains exactly 1 item
 
+	EmuDuration pendingSkip = EmuDuration::zero();
+
 	bool powered = false;
 	bool active = false;
+	bool inBackground = false;
 	bool fastForwarding = false;
 };
 SERIALIZE_CLASS_VERSION(MSXMotherBoard, 5);
@@ -2,6 +2,7 @@
 
 #include "AfterCommand.hh"
 #include "AviRecorder.hh"
+#include "BinarySavestate.hh"
 #include "BooleanSetting.hh"
 #include "Command.hh"
 #include "CommandException.hh"
@@ -33,6 +34,7 @@
 #include "RomInfo.hh"
 #include "StateChangeDistributor.hh"
 #include "SymbolManager.hh"
+#include "TclArgParser.hh"
 #include "TclCallbackMessages.hh"
 #include "TclObject.hh"
 #include "UserSettings.hh"
@@ -685,6 +687,9 @@ void Reactor::run()
 			auto copy = activeBoard;
 			blocked = !copy->execute();
 		}
+		if (runBackgroundBoards()) {
+			blocked = false;
+		}
 		if (blocked) {
 			// At first sight a better alternative is to use the
 			// SDL_WaitEvent() function. Though when inspecting
@@ -697,6 +702,26 @@ void Reactor::run()
 	}
 }
 
+bool Reactor::runBackgroundBoards()
+{
+	// Same as for the active machine: nothing runs while paused (or
+	// otherwise blocked, e.g. on a debugger break).
+	if (paused || (blockedCounter > 0)) return false;
+	if (std::ranges::none_of(boards, &MSXMotherBoard::isRunningInBackground)) {
+		return false;
+	}
+	// Give each background machine one time slice (until its next
+	// exitCPULoopSync(), which happens regularly, see MSXMixer). Iterate
+	// over a copy, Tcl callbacks might create or delete machines.
+	bool executed = false;
+	for (auto copy = boards; auto& board : copy) {
+		if (blockedCounter > 0) break;
+		if (!board->isRunningInBackground() || !contains(boards, board)) continue;
+		executed |= board->execute();
+	}
+	return executed;
+}
+
 void Reactor::unpause()
 {
 	if (paused) {
@@ -1027,22 +1052,34 @@ StoreMachineCommand::StoreMachineCommand(
 
 void StoreMachineCommand::execute(std::span<const TclObject> tokens, TclObject& result)
 {
-	checkNumArgs(tokens, 3, Prefix{1}, "id filename");
-	const auto& machineID = tokens[1].getString();
-	const auto& filename = tokens[2].getString();
+	bool binary = false;
+	std::array info = {flagArg("-binary", binary)};
+	auto arguments = parseTclArgs(getInterpreter(), tokens.subspan(1), info);
+	if (arguments.size() != 2) {
+		throw SyntaxError();
+	}
+	const auto& machineID = arguments[0].getString();
+	std::string filename(arguments[1].getString());
 
 	const auto& board = *reactor.getMachine(machineID);
 
-	XmlOutputArchive out(filename);
-	out.serialize("machine", board);
-	out.close();
+	if (binary) {
+		BinarySavestate::saveMachine(filename, board);
+	} else {
+		XmlOutputArchive out(filename);
+		out.serialize("machine", board);
+		out.close();
+	}
 	result = filename;
 }
 
 std::string StoreMachineCommand::help(std::span<const TclObject> /*tokens*/) const
 {
 	return
-		"store_machine machineID <filename>  Save state of machine \"machineID\" to indicated file\n"
+		"store_machine [-binary] machineID <filename>  Save state of machine \"machineID\" to indicated file\n"
+		"\n"
+		"With -binary the state is stored in a binary format. That's a lot faster to save\n"
+		"and load, but it can only be loaded again by the same openMSX version.\n"
 		"\n"
 		"This is a low-level command, the 'savestate' script is easier to use.";
 }
@@ -1071,8 +1108,7 @@ void RestoreMachineCommand::execute(std::span<const TclObject> tokens,
 	const auto filename = FileOperations::expandTilde(std::string(tokens[1].getString()));
 
 	try {
-		XmlInputArchive in(filename);
-		in.serialize("machine", *newBoard);
+		BinarySavestate::loadMachine(filename, *newBoard);
 	} catch (XMLException& e) {
 		throw CommandException("Cannot load state, bad file format: ",
 		                       e.getMessage());
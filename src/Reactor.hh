@@ -156,6 +156,11 @@ private:
 	// EventListener
 	bool signalEvent(const Event& event) override;
 
+	/** Give each machine with 'run_in_background' enabled one time
+	  * slice. These run one after the other on the main thread, not in
+	  * parallel. Returns true iff any machine actually executed.
+	  */
+	[[nodiscard]] bool runBackgroundBoards();
 	void unpause();
 	void pause();
 
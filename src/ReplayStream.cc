@@ -0,0 +1,320 @@
+#include "ReplayStream.hh"
+
+#include "FileException.hh"
+#include "MSXException.hh"
+#include "StateChange.hh"
+#include "Version.hh"
+#include "serialize.hh"
+#include "serialize_meta.hh"
+
+#include "DeltaBlock.hh"
+#include "endian.hh"
+#include "narrow.hh"
+#include "xrange.hh"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+
+namespace openmsx {
+
+// Limit the number of records waiting to be written. When the disk can't keep
+// up, emulation is slowed down instead of using more and more memory.
+static constexpr size_t MAX_QUEUED_RECORDS = 8;
+
+static constexpr size_t HEADER_SIZE = 8 + 4 + 4; // excluding version string
+static constexpr size_t RECORD_HEADER_SIZE = 4 + 4 + 4;
+
+[[nodiscard]] static uint32_t checksum(std::span<const uint8_t> data)
+{
+	return narrow_cast<uint32_t>(crc32(crc32(0, nullptr, 0), data.data(), narrow<uInt>(data.size())));
+}
+
+static void append32(std::vector<uint8_t>& buf, uint32_t x)
+{
+	auto pos = buf.size();
+	buf.resize(pos + 4);
+	Endian::write_UA_L32(&buf[pos], x);
+}
+
+static void append64(std::vector<uint8_t>& buf, uint64_t x)
+{
+	auto pos = buf.size();
+	buf.resize(pos + 8);
+	Endian::write_UA_L64(&buf[pos], x);
+}
+
+// class ReplayStreamWriter
+
+ReplayStreamWriter::~ReplayStreamWriter()
+{
+	close();
+}
+
+void ReplayStreamWriter::open(const std::string& filename_)
+{
+	close();
+	file = File(filename_, File::OpenMode::TRUNCATE);
+	auto version = Version::full();
+	std::vector<uint8_t> header(MAGIC.begin(), MAGIC.end());
+	append32(header, FORMAT_VERSION);
+	append32(header, narrow<uint32_t>(version.size()));
+	header.insert(header.end(), version.begin(), version.end());
+	file.write(header);
+	file.flush();
+	filename = filename_;
+	stop = false;
+	writeError = false;
+	thread = std::thread([this] { writerMain(); });
+}
+
+bool ReplayStreamWriter::close()
+{
+	if (!isOpen()) return true;
+	{
+		std::scoped_lock lock(mutex);
+		stop = true;
+	}
+	cond.notify_all();
+	thread.join();
+	file.close();
+	filename.clear();
+	return !writeError;
+}
+
+bool ReplayStreamWriter::flush()
+{
+	std::unique_lock lock(mutex);
+	cond.wait(lock, [&] { return queue.empty() && !busy; });
+	return !writeError;
+}
+
+void ReplayStreamWriter::push(Job&& job)
+{
+	assert(isOpen());
+	{
+		std::unique_lock lock(mutex);
+		cond.wait(lock, [&] { return queue.size() < MAX_QUEUED_RECORDS; });
+		queue.push_back(std::move(job));
+	}
+	cond.notify_all();
+}
+
+void ReplayStreamWriter::addEvents(const Events& events, size_t first)
+{
+	assert(first <= events.size());
+	if (first == events.size()) return;
+
+	// The events are small, serialize them right away, so that the
+	// caller is free to modify 'events' afterwards.
+	LastDeltaBlocks lastDeltaBlocks;
+	std::vector<std::shared_ptr<DeltaBlock>> deltaBlocks;
+	MemOutputArchive out(lastDeltaBlocks, deltaBlocks, false);
+	for (auto i : xrange(first, events.size())) {
+		out.serialize("event", events[i]);
+	}
+	auto buffer = std::move(out).releaseBuffer();
+	assert(deltaBlocks.empty());
+
+	Job job;
+	job.type = EVENTS;
+	append32(job.payload, narrow<uint32_t>(first));
+	append32(job.payload, narrow<uint32_t>(events.size() - first));
+	job.payload.insert(job.payload.end(), buffer.begin(), buffer.end());
+	push(std::move(job));
+}
+
+void ReplayStreamWriter::addKeyframe(
+	EmuTime time, unsigned reRecordCount, std::span<const uint8_t> savestate,
+	std::span<const std::shared_ptr<DeltaBlock>> deltaBlocks)
+{
+	Job job;
+	job.type = KEYFRAME;
+	append64(job.payload, (time - EmuTime::zero()).length());
+	append32(job.payload, reRecordCount);
+	job.savestate = MemBuffer<uint8_t>(savestate.size());
+	copy_to_range(savestate, job.savestate);
+	job.deltaBlocks.assign(deltaBlocks.begin(), deltaBlocks.end());
+	push(std::move(job));
+}
+
+void ReplayStreamWriter::truncate(EmuTime time, size_t numEvents, unsigned reRecordCount)
+{
+	Job job;
+	job.type = TRUNCATE;
+	append64(job.payload, (time - EmuTime::zero()).length());
+	append32(job.payload, narrow<uint32_t>(numEvents));
+	append32(job.payload, reRecordCount);
+	push(std::move(job));
+}
+
+void ReplayStreamWriter::writerMain()
+{
+	std::unique_lock lock(mutex);
+	while (true) {
+		cond.wait(lock, [&] { return stop || !queue.empty(); });
+		if (queue.empty()) return; // stop requested and all records written
+		auto job = std::move(queue.front());
+		queue.pop_front();
+		busy = true;
+		lock.unlock();
+		cond.notify_all(); // there's room in the queue again
+
+		if (job.type == KEYFRAME) {
+			// (DeltaBlocks can safely be applied from this thread)
+			std::array states = {BinarySavestate::StateRef{
+				.buffer = job.savestate, .deltaBlocks = job.deltaBlocks}};
+			auto encoded = BinarySavestate::encode(states);
+			job.payload.insert(job.payload.end(), encoded.begin(), encoded.end());
+			job.savestate = MemBuffer<uint8_t>(); // release the state
+			job.deltaBlocks.clear();
+		}
+		std::vector<uint8_t> header;
+		append32(header, job.type);
+		append32(header, narrow<uint32_t>(job.payload.size()));
+		append32(header, checksum(job.payload));
+		bool error = false;
+		try {
+			if (!writeError) {
+				file.write(header);
+				file.write(job.payload);
+				// Hand over to the OS after each record, so that
+				// everything up to here survives a crash of openMSX.
+				file.flush();
+			}
+		} catch (FileException&) {
+			error = true;
+		}
+
+		lock.lock();
+		busy = false;
+		if (error) writeError = true;
+		cond.notify_all(); // for flush()
+	}
+}
+
+
+// class ReplayStreamReader
+
+[[nodiscard]] static bool hasMagic(std::span<const uint8_t> data)
+{
+	const auto& magic = ReplayStreamWriter::MAGIC;
+	return (data.size() >= magic.size()) &&
+	       std::ranges::equal(data.first(magic.size()), magic,
+	                          [](uint8_t m, char c) { return m == uint8_t(c); });
+}
+
+bool ReplayStreamReader::isReplayStream(const std::string& filename)
+{
+	try {
+		File file(filename);
+		std::array<uint8_t, ReplayStreamWriter::MAGIC.size()> buf;
+		if (file.getSize() < buf.size()) return false;
+		file.read(buf);
+		return hasMagic(buf);
+	} catch (MSXException&) {
+		return false;
+	}
+}
+
+ReplayStreamReader::ReplayStreamReader(const std::string& filename)
+{
+	File file(filename);
+	mapping = file.mmap<const uint8_t>();
+	std::span<const uint8_t> data{mapping.data(), mapping.size()};
+
+	if ((data.size() < HEADER_SIZE) || !hasMagic(data)) {
+		throw MSXException("Invalid replay stream: bad header");
+	}
+	if (auto formatVersion = Endian::read_UA_L32(&data[8]); formatVersion != ReplayStreamWriter::FORMAT_VERSION) {
+		throw MSXException("Invalid replay stream: unsupported format version ", formatVersion);
+	}
+	size_t versionSize = Endian::read_UA_L32(&data[12]);
+	if ((data.size() - HEADER_SIZE) < versionSize) {
+		throw MSXException("Invalid replay stream: truncated header");
+	}
+	std::string_view version(std::bit_cast<const char*>(&data[HEADER_SIZE]), versionSize);
+	if (version != Version::full()) {
+		throw MSXException("Replay stream was created by ", version,
+		                   ", it can only be loaded by that version.");
+	}
+
+	// Process the records in order. Stop at the first incomplete or
+	// damaged one, that's where openMSX crashed (or was killed) while
+	// writing.
+	std::map<uint64_t, std::span<const uint8_t>> keyframeMap; // time -> data
+	size_t pos = HEADER_SIZE + versionSize;
+	while ((data.size() - pos) >= RECORD_HEADER_SIZE) {
+		auto type = Endian::read_UA_L32(&data[pos + 0]);
+		size_t size = Endian::read_UA_L32(&data[pos + 4]);
+		auto crc    = Endian::read_UA_L32(&data[pos + 8]);
+		pos += RECORD_HEADER_SIZE;
+		if ((data.size() - pos) < size) break;
+		auto payload = data.subspan(pos, size);
+		if (checksum(payload) != crc) break;
+		pos += size;
+
+		try {
+			switch (type) {
+			case ReplayStreamWriter::EVENTS: {
+				if (payload.size() < 8) throw MSXException("truncated record");
+				auto first = Endian::read_UA_L32(&payload[0]);
+				auto num   = Endian::read_UA_L32(&payload[4]);
+				if (first > events.size()) throw MSXException("missing events");
+				events.resize(first);
+				MemInputArchive in(payload.subspan(8), {});
+				for ([[maybe_unused]] auto i : xrange(num)) {
+					std::unique_ptr<StateChange> event;
+					in.serialize("event", event);
+					events.push_back(std::move(event));
+				}
+				break;
+			}
+			case ReplayStreamWriter::KEYFRAME: {
+				if (payload.size() < 12) throw MSXException("truncated record");
+				auto time = Endian::read_UA_L64(&payload[0]);
+				reRecordCount = Endian::read_UA_L32(&payload[8]);
+				keyframeMap[time] = payload.subspan(12);
+				break;
+			}
+			case ReplayStreamWriter::TRUNCATE: {
+				if (payload.size() < 16) throw MSXException("truncated record");
+				auto time = Endian::read_UA_L64(&payload[0]);
+				auto num  = Endian::read_UA_L32(&payload[8]);
+				reRecordCount = Endian::read_UA_L32(&payload[12]);
+				if (num < events.size()) events.resize(num);
+				keyframeMap.erase(keyframeMap.upper_bound(time), keyframeMap.end());
+				break;
+			}
+			default:
+				throw MSXException("unknown record type ", type);
+			}
+		} catch (MSXException& e) {
+			throw MSXException("Invalid replay stream: ", e.getMessage());
+		}
+	}
+
+	if (keyframeMap.empty()) {
+		throw MSXException("Invalid replay stream: no keyframes");
+	}
+	for (const auto& [time, kfData] : keyframeMap) {
+		keyframes.push_back({.time = EmuTime::zero() + EmuDuration(time), .data = kfData});
+	}
+	endTime = keyframes.back().time;
+	if (!events.empty()) endTime = std::max(endTime, events.back()->getTime());
+}
+
+ReplayStreamReader::~ReplayStreamReader() = default;
+
+BinarySavestate::State ReplayStreamReader::loadKeyframe(const Keyframe& keyframe) const
+{
+	auto states = BinarySavestate::decode(keyframe.data);
+	if (states.size() != 1) {
+		throw MSXException("Invalid replay stream: bad keyframe");
+	}
+	return std::move(states[0]);
+}
+
+} // namespace openmsx
@@ -0,0 +1,161 @@
+#ifndef REPLAYSTREAM_HH
+#define REPLAYSTREAM_HH
+
+#include "BinarySavestate.hh"
+#include "EmuTime.hh"
+#include "File.hh"
+#include "MappedFile.hh"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openmsx {
+
+class DeltaBlock;
+class StateChange;
+
+/** Writes a replay to file while it's being recorded.
+  *
+  * Instead of writing the whole replay at once (like 'reverse savereplay'
+  * does), the recorded events and regular keyframes (snapshots) are appended
+  * to the file as they become available. Each record has its own size and
+  * checksum, so after a crash everything up to the last completely written
+  * record can still be loaded. Records are written by a separate thread.
+  *
+  * File format (all values little endian):
+  *   header:  the 8 bytes MAGIC, uint32 FORMAT_VERSION, uint32 length of the
+  *            openMSX version string, the version string itself
+  *   records: uint32 type, uint32 payload size, uint32 CRC-32 of the
+  *            payload, the payload
+  * Record types:
+  *   EVENTS:   uint32 index of the first event, uint32 number of events,
+  *             the events in MemOutputArchive format
+  *   KEYFRAME: uint64 time, uint32 re-record count, the snapshot in
+  *             BinarySavestate format
+  *   TRUNCATE: uint64 time, uint32 number of remaining events, uint32
+  *             re-record count. Removes the later events and keyframes
+  *             (history was changed, e.g. after 'reverse goto').
+  * Like the BinarySavestate format, this can only be loaded by the same
+  * openMSX version.
+  */
+class ReplayStreamWriter
+{
+public:
+	static constexpr std::array<char, 8> MAGIC = {'O', 'M', 'S', 'X', 'R', 'P', 'L', 'S'};
+	static constexpr uint32_t FORMAT_VERSION = 1;
+	enum RecordType : uint32_t { EVENTS = 0, KEYFRAME = 1, TRUNCATE = 2 };
+	using Events = std::deque<std::unique_ptr<StateChange>>;
+
+	ReplayStreamWriter() = default;
+	ReplayStreamWriter(const ReplayStreamWriter&) = delete;
+	ReplayStreamWriter(ReplayStreamWriter&&) = delete;
+	ReplayStreamWriter& operator=(const ReplayStreamWriter&) = delete;
+	ReplayStreamWriter& operator=(ReplayStreamWriter&&) = delete;
+	~ReplayStreamWriter();
+
+	/** Start a new stream, an already open stream is closed first.
+	  * @throws FileException when the file can't be created.
+	  */
+	void open(const std::string& filename);
+
+	/** Write all pending records and close the file.
+	  * @return False iff (some of) the data couldn't be written.
+	  */
+	bool close();
+
+	/** Wait till all pending records are written (the stream stays open).
+	  * @return False iff (some of) the data couldn't be written.
+	  */
+	bool flush();
+
+	[[nodiscard]] bool isOpen() const { return thread.joinable(); }
+	[[nodiscard]] const std::string& getFilename() const { return filename; }
+
+	/** Append events [first, events.size()). Only allowed while open. */
+	void addEvents(const Events& events, size_t first);
+
+	/** Append a keyframe. The data is copied (the DeltaBlocks are shared),
+	  * the actual compression happens on the writer thread.
+	  */
+	void addKeyframe(EmuTime time, unsigned reRecordCount,
+	                 std::span<const uint8_t> savestate,
+	                 std::span<const std::shared_ptr<DeltaBlock>> deltaBlocks);
+
+	/** Remove all events from index 'numEvents' on and all keyframes after
+	  * 'time'.
+	  */
+	void truncate(EmuTime time, size_t numEvents, unsigned reRecordCount);
+
+private:
+	struct Job {
+		RecordType type = EVENTS;
+		std::vector<uint8_t> payload;
+		// only for KEYFRAME, appended to 'payload' by the writer thread
+		MemBuffer<uint8_t> savestate;
+		std::vector<std::shared_ptr<DeltaBlock>> deltaBlocks;
+	};
+	void push(Job&& job);
+	void writerMain();
+
+private:
+	std::string filename;
+
+	// Shared with the writer thread.
+	File file; // only used by the writer thread while it runs
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::deque<Job> queue;
+	bool busy = false; // writer thread is writing a record
+	bool stop = false;
+	bool writeError = false;
+};
+
+/** Reads a file written by ReplayStreamWriter. The file is memory mapped,
+  * only the records up to the last complete one are used. Events are
+  * decoded immediately, keyframes only on request.
+  */
+class ReplayStreamReader
+{
+public:
+	struct Keyframe {
+		EmuTime time;
+		std::span<const uint8_t> data; // in BinarySavestate format
+	};
+
+	/** @throws MSXException when the file can't be read, isn't a replay
+	  *         stream or was created by a different openMSX version.
+	  */
+	explicit ReplayStreamReader(const std::string& filename);
+	~ReplayStreamReader();
+
+	[[nodiscard]] static bool isReplayStream(const std::string& filename);
+
+	/** All events. After a crash the final EndLogEvent is missing. */
+	[[nodiscard]] ReplayStreamWriter::Events& getEvents() { return events; }
+	/** Time of the last event or keyframe. */
+	[[nodiscard]] EmuTime getEndTime() const { return endTime; }
+	[[nodiscard]] unsigned getReRecordCount() const { return reRecordCount; }
+	/** Sorted on time, never empty. */
+	[[nodiscard]] std::span<const Keyframe> getKeyframes() const { return keyframes; }
+	[[nodiscard]] BinarySavestate::State loadKeyframe(const Keyframe& keyframe) const;
+
+private:
+	MappedFile<const uint8_t> mapping;
+	ReplayStreamWriter::Events events;
+	std::vector<Keyframe> keyframes;
+	EmuTime endTime = EmuTime::zero();
+	unsigned reRecordCount = 0;
+};
+
+} // namespace openmsx
+
+#endif
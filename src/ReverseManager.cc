@@ -1,5 +1,6 @@
 #include "ReverseManager.hh"
 
+#include "BinarySavestate.hh"
 #include "CommandException.hh"
 #include "Debugger.hh"
 #include "Display.hh"
@@ -14,6 +15,7 @@
 #include "MSXMixer.hh"
 #include "MSXMotherBoard.hh"
 #include "Reactor.hh"
+#include "ReplayStream.hh"
 #include "StateChange.hh"
 #include "StateChangeDistributor.hh"
 #include "TclArgParser.hh"
@@ -25,12 +27,17 @@
 
 #include "narrow.hh"
 #include "one_of.hh"
+#include "xrange.hh"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
 #include <iomanip>
+#include <limits>
 #include <ranges>
+#include <set>
+#include <unordered_set>
 
 namespace openmsx {
 
@@ -39,6 +46,19 @@ using namespace std::literals;
 // Time between two snapshots (in seconds)
 static constexpr double SNAPSHOT_PERIOD = 1.0;
 
+// When a memory budget is set, try to fit (at least) this many snapshots in
+// it. When snapshots are too large for that, they're taken less often.
+static constexpr double NOF_BUDGET_SNAPSHOTS = 100.0;
+
+// But don't take them less often than this (in seconds). Either this or (once
+// the replay speed is known) the time such a distance takes to replay during
+// 'reverse goto', see below.
+static constexpr double MAX_SNAPSHOT_PERIOD = 10.0;
+
+// Max (host) time it may take to replay from one snapshot to the next (in
+// seconds).
+static constexpr double MAX_REPLAY_TIME = 1.0;
+
 // Max number of snapshots in a replay file
 static constexpr unsigned MAX_NOF_SNAPSHOTS = 10;
 
@@ -48,6 +68,23 @@ static constexpr auto MIN_PARTITION_LENGTH = EmuDuration::sec(60.0);
 // Max distance of one before last snapshot before the end time in replay file
 static constexpr auto MAX_DIST_1_BEFORE_LAST_SNAPSHOT = EmuDuration::sec(30.0);
 
+// Default time between two keyframes in a replay stream (in seconds)
+static constexpr double DEFAULT_KEYFRAME_INTERVAL = 10.0;
+
+// Pre-roll runs in slices of (at most) this much host time, with this much
+// time in between (both in us), so that the UI stays responsive.
+static constexpr uint64_t PRE_ROLL_SLICE = 5000;
+static constexpr uint64_t PRE_ROLL_INTERVAL = 20000;
+
+// Amount of emulated time per fastForward() call during pre-roll
+static constexpr auto PRE_ROLL_STEP = EmuDuration::msec(20);
+
+// Only (re)start a pre-roll when the target stayed after the same snapshot for
+// this long (in us). Starting is expensive (it creates and loads a hidden
+// board), and e.g. moving the mouse over the reverse bar changes the target
+// every frame.
+static constexpr uint64_t PRE_ROLL_DELAY = 200000;
+
 // A replay is a struct that contains a vector of motherboards and an MSX event
 // log. Those combined are a replay, because you can replay the events from an
 // existing motherboard state: the vector has to have at least one motherboard
@@ -100,12 +137,37 @@ struct Replay
 SERIALIZE_CLASS_VERSION(Replay, 4);
 
 
+// struct ReplayStream
+
+struct ReverseManager::ReplayStream
+{
+	[[nodiscard]] unsigned getKeyframeSeqNum(EmuTime time) const {
+		return unsigned((time - EmuTime::zero()).toDouble() / keyframeInterval);
+	}
+
+	ReplayStreamWriter writer;
+	double keyframeInterval = DEFAULT_KEYFRAME_INTERVAL;
+	size_t numEvents = 0; // number of events already written
+	std::set<unsigned> keyframes; // seqNums of the written keyframes
+
+	// History was changed (in stopReplay()), but that's not yet written.
+	// Writing can throw or block, so it's postponed till the next write.
+	struct Truncate {
+		EmuTime time;
+		size_t numEvents;
+		unsigned reRecordCount;
+	};
+	std::optional<Truncate> pendingTruncate;
+};
+
+
 // struct ReverseHistory
 
 void ReverseManager::ReverseHistory::swap(ReverseHistory& other) noexcept
 {
 	std::swap(chunks, other.chunks);
 	std::swap(events, other.events);
+	std::swap(stream, other.stream);
 }
 
 void ReverseManager::ReverseHistory::clear()
@@ -113,6 +175,7 @@ void ReverseManager::ReverseHistory::clear()
 	// clear() and free storage capacity
 	Chunks().swap(chunks);
 	Events().swap(events);
+	stream.reset();
 }
 
 
@@ -132,14 +195,34 @@ public:
 };
 REGISTER_POLYMORPHIC_CLASS(StateChange, EndLogEvent, "EndLog");
 
+// struct PreRoll
+
+// A hidden board that emulates from a snapshot towards a pre-roll target.
+struct ReverseManager::PreRoll
+{
+	Reactor::Board board;
+	LastDeltaBlocks lastDeltaBlocks; // the 'ids' differ from the main board
+	unsigned firstEvent = 0; // index in the event log of the board's first event
+	EmuTime startTime = EmuTime::zero(); // time of the snapshot the board started from
+	EmuTime endTime = EmuTime::zero(); // time of the last event the board can replay
+	unsigned generation = 0; // see 'historyGeneration'
+	size_t memoryUsage = 0; // estimate, see startPreRoll()
+};
+
+
 // class ReverseManager
 
 ReverseManager::ReverseManager(MSXMotherBoard& motherBoard_)
 	: syncNewSnapshot(motherBoard_.getScheduler())
 	, syncInputEvent (motherBoard_.getScheduler())
+	, preRollStep(motherBoard_.getReactor().getRTScheduler())
 	, motherBoard(motherBoard_)
 	, eventDistributor(motherBoard.getReactor().getEventDistributor())
 	, reverseCmd(motherBoard.getCommandController())
+	, memoryBudgetSetting(motherBoard.getCommandController(), "reverse_memory_budget",
+		"max amount of memory (in MB) used by the reverse snapshots (0 = no limit)",
+		0, 0, 1024 * 1024)
+	, snapshotPeriod(SNAPSHOT_PERIOD)
 {
 	eventDistributor.registerEventListener(EventType::TAKE_REVERSE_SNAPSHOT, *this);
 
@@ -178,6 +261,10 @@ void ReverseManager::stop()
 		motherBoard.getStateChangeDistributor().unregisterRecorder(*this);
 		syncNewSnapshot.removeSyncPoint(); // don't schedule new snapshot takings
 		syncInputEvent .removeSyncPoint(); // stop any pending replay actions
+		preRollStep.cancelRT();
+		preRoll.reset();
+		preRollTarget.reset();
+		closeStream();
 		history.clear();
 		replayIndex = 0;
 		collecting = false;
@@ -248,6 +335,8 @@ void ReverseManager::status(TclObject& result) const
 	}
 	EmuTime le(isCollecting() && (lastEvent != rend(history.events)) ? (*lastEvent)->getTime() : EmuTime::zero());
 	result.addDictKeyValue("last_event", (le - EmuTime::zero()).toDouble());
+	result.addDictKeyValue("stream", history.stream ? std::string_view(history.stream->writer.getFilename())
+	                                                : std::string_view{});
 }
 
 void ReverseManager::debugInfo(TclObject& result) const
@@ -264,7 +353,14 @@ void ReverseManager::debugInfo(TclObject& result) const
 		          " (next event index: ", chunk.eventCount, ")\n");
 		totalSize += chunk.savestate.size();
 	}
-	strAppend(res, "total size: ", totalSize, '\n');
+	strAppend(res, "total size: ", totalSize, '\n',
+	          "memory usage (including memory blocks): ", history.getMemoryUsage(),
+	          " (budget: ", size_t(memoryBudgetSetting.getInt()) * 1024 * 1024, ")\n",
+	          "pre-roll memory usage (estimate): ", (preRoll ? preRoll->memoryUsage : 0), '\n',
+	          "snapshot period: ", snapshotPeriod, '\n',
+	          "average replay time: ",
+	          (replayStats.count ? replayStats.hostTime / replayStats.count : 0.0),
+	          " (", replayStats.count, " times)\n");
 	result = res;
 }
 
@@ -402,16 +498,26 @@ void ReverseManager::goTo(
 			// to fast forward to the right time
 			newBoard->getMSXCliComm().setSuppressMessages(true);
 		} else {
-			// Note: we don't (anymore) erase future snapshots
-			// -- restore old snapshot --
-			newBoard_ = reactor.createEmptyMotherBoard();
-			newBoard = newBoard_.get();
-			// suppress messages we'd get by deserializing (and
-			// thus instantiating the parts of) the new board
-			newBoard->getMSXCliComm().setSuppressMessages(true);
-			MemInputArchive in(chunk.savestate,
-					   chunk.deltaBlocks);
-			in.serialize("machine", *newBoard);
+			// Maybe a board was already pre-rolled closer to the
+			// target time, if so continue from there.
+			unsigned eventCount = chunk.eventCount;
+			if (sameTimeLine) {
+				newBoard_ = takePreRolledBoard(snapshotTime, preTarget, eventCount);
+			}
+			if (newBoard_) {
+				newBoard = newBoard_.get();
+			} else {
+				// Note: we don't (anymore) erase future snapshots
+				// -- restore old snapshot --
+				newBoard_ = reactor.createEmptyMotherBoard();
+				newBoard = newBoard_.get();
+				// suppress messages we'd get by deserializing (and
+				// thus instantiating the parts of) the new board
+				newBoard->getMSXCliComm().setSuppressMessages(true);
+				MemInputArchive in(chunk.savestate,
+						   chunk.deltaBlocks);
+				in.serialize("machine", *newBoard);
+			}
 
 			if (eventDelay) {
 				// Handle all events that are scheduled, but not yet
@@ -431,7 +537,7 @@ void ReverseManager::goTo(
 			// Also we should stop collecting in this ReverseManager,
 			// and start collecting in the new one.
 			auto& newManager = newBoard->getReverseManager();
-			newManager.transferHistory(hist, chunk.eventCount);
+			newManager.transferHistory(hist, eventCount);
 
 			// transfer (or copy) state from old to new machine
 			transferState(*newBoard);
@@ -447,7 +553,8 @@ void ReverseManager::goTo(
 		// at least the usual interval, but the later, the more: each
 		// time divide the remaining time in half and make a snapshot
 		// there.
-		auto lastProgress = Timer::getTime();
+		auto startHostTime = Timer::getTime();
+		auto lastProgress = startHostTime;
 		auto startMSXTime = newBoard->getCurrentTime();
 		auto lastSnapshotTarget = startMSXTime;
 		bool everShowedProgress = false;
@@ -457,7 +564,7 @@ void ReverseManager::goTo(
 			auto nextSnapshotTarget = std::min(
 				preTarget,
 				lastSnapshotTarget + std::max(
-					EmuDuration::sec(SNAPSHOT_PERIOD),
+					EmuDuration::sec(snapshotPeriod),
 					(preTarget - lastSnapshotTarget) / 2
 					));
 			auto nextTarget = std::min(nextSnapshotTarget, currentTimeNewBoard + EmuDuration::sec(1));
@@ -501,6 +608,11 @@ void ReverseManager::goTo(
 		// This makes sure the video output gets rendered.
 		newBoard->fastForward(targetTime, false);
 
+		auto& stats = newBoard->getReverseManager().replayStats;
+		stats.count += 1;
+		stats.hostTime += double(Timer::getTime() - startHostTime) * 1e-6;
+		stats.emuTime += (targetTime - startMSXTime).toDouble();
+
 		// In case we didn't actually create a new board, don't leave
 		// the (old) board muted.
 		if (unmute) {
@@ -537,49 +649,24 @@ void ReverseManager::transferState(MSXMotherBoard& newBoard)
 	// copy rerecord count
 	newManager.reRecordCount = reRecordCount;
 
+	// copy the snapshot density and the statistics it's based on
+	newManager.snapshotPeriod = snapshotPeriod;
+	newManager.replayStats = replayStats;
+
 	// transfer settings
 	const auto& oldController = motherBoard.getMSXCommandController();
 	newBoard.getMSXCommandController().transferSettings(oldController);
 }
 
-void ReverseManager::saveReplay(
-	Interpreter& interp, std::span<const TclObject> tokens, TclObject& result)
+std::vector<const ReverseManager::ReverseChunk*> ReverseManager::selectReplaySnapshots(
+	int maxNofExtraSnapshots) const
 {
 	const auto& chunks = history.chunks;
-	if (chunks.empty()) {
-		throw CommandException("No recording...");
-	}
+	assert(!chunks.empty());
 
-	std::string_view filenameArg;
-	int maxNofExtraSnapshots = MAX_NOF_SNAPSHOTS;
-	std::array info = {valueArg("-maxnofextrasnapshots", maxNofExtraSnapshots)};
-	auto args = parseTclArgs(interp, tokens.subspan(2), info);
-	switch (args.size()) {
-		case 0: break; // nothing
-		case 1: filenameArg = args[0].getString(); break;
-		default: throw SyntaxError();
-	}
-	if (maxNofExtraSnapshots < 0) {
-		throw CommandException("Maximum number of snapshots should be at least 0");
-	}
-
-	auto filename = FileOperations::parseCommandFileArgument(
-		filenameArg, REPLAY_DIR, "openmsx", REPLAY_EXTENSION);
-
-	auto& reactor = motherBoard.getReactor();
-	Replay replay(reactor);
-	replay.reRecordCount = reRecordCount;
-
-	// store current time (possibly somewhere in the middle of the timeline)
-	// so that on load we can go back there
-	replay.currentTime = getCurrentTime();
-
-	// restore first snapshot to be able to serialize it to a file
-	auto initialBoard = reactor.createEmptyMotherBoard();
-	MemInputArchive in(begin(chunks)->second.savestate,
-			   begin(chunks)->second.deltaBlocks);
-	in.serialize("machine", *initialBoard);
-	replay.motherBoards.push_back(std::move(initialBoard));
+	// the first snapshot is always included
+	std::vector<const ReverseChunk*> result;
+	result.push_back(&begin(chunks)->second);
 
 	if (maxNofExtraSnapshots > 0) {
 		// determine which extra snapshots to put in the replay
@@ -603,11 +690,7 @@ void ReverseManager::saveReplay(
 				assert(it->second.time <= nextPartitionEnd);
 				if (it != lastAddedIt) {
 					// this is a new one, add it to the list of snapshots
-					Reactor::Board board = reactor.createEmptyMotherBoard();
-					MemInputArchive in2(it->second.savestate,
-							    it->second.deltaBlocks);
-					in2.serialize("machine", *board);
-					replay.motherBoards.push_back(std::move(board));
+					result.push_back(&it->second);
 					lastAddedIt = it;
 				}
 				++it;
@@ -618,6 +701,67 @@ void ReverseManager::saveReplay(
 		}
 		assert(lastAddedIt == std::prev(end(chunks))); // last snapshot must be included
 	}
+	return result;
+}
+
+void ReverseManager::saveReplay(
+	Interpreter& interp, std::span<const TclObject> tokens, TclObject& result)
+{
+	const auto& chunks = history.chunks;
+	if (chunks.empty()) {
+		throw CommandException("No recording...");
+	}
+
+	std::string_view filenameArg;
+	int maxNofExtraSnapshots = MAX_NOF_SNAPSHOTS;
+	bool binary = false;
+	std::array info = {
+		valueArg("-maxnofextrasnapshots", maxNofExtraSnapshots),
+		flagArg("-binary", binary),
+	};
+	auto args = parseTclArgs(interp, tokens.subspan(2), info);
+	switch (args.size()) {
+		case 0: break; // nothing
+		case 1: filenameArg = args[0].getString(); break;
+		default: throw SyntaxError();
+	}
+	if (maxNofExtraSnapshots < 0) {
+		throw CommandException("Maximum number of snapshots should be at least 0");
+	}
+
+	if (history.stream && filenameArg.empty()) {
+		// The replay is already being written, only make sure
+		// everything so far is on disk.
+		streamEvents();
+		if (!history.stream->writer.flush()) {
+			throw CommandException("Error while writing replay stream ",
+			                       history.stream->writer.getFilename());
+		}
+		result = history.stream->writer.getFilename();
+		return;
+	}
+
+	auto filename = FileOperations::parseCommandFileArgument(
+		filenameArg, REPLAY_DIR, "openmsx", REPLAY_EXTENSION);
+
+	auto& reactor = motherBoard.getReactor();
+	Replay replay(reactor);
+	replay.reRecordCount = reRecordCount;
+
+	// store current time (possibly somewhere in the middle of the timeline)
+	// so that on load we can go back there
+	replay.currentTime = getCurrentTime();
+
+	auto snapshots = selectReplaySnapshots(maxNofExtraSnapshots);
+	if (!binary) {
+		// restore the snapshots to be able to serialize them to a file
+		for (const auto* chunk : snapshots) {
+			auto board = reactor.createEmptyMotherBoard();
+			MemInputArchive in(chunk->savestate, chunk->deltaBlocks);
+			in.serialize("machine", *board);
+			replay.motherBoards.push_back(std::move(board));
+		}
+	}
 
 	// add sentinel when there isn't one yet
 	bool addSentinel = history.events.empty() ||
@@ -628,10 +772,30 @@ void ReverseManager::saveReplay(
 			getCurrentTime()));
 	}
 	try {
-		XmlOutputArchive out(filename);
 		replay.events = &history.events;
-		out.serialize("replay", replay);
-		out.close();
+		if (binary) {
+			// The snapshots are stored as-is (no need to restore
+			// them). The first state holds the replay itself.
+			std::vector<EmuDuration> snapshotTimes; // relative to EmuTime::zero()
+			for (const auto* chunk : snapshots) snapshotTimes.push_back(chunk->time - EmuTime::zero());
+			LastDeltaBlocks lastDeltaBlocks;
+			std::vector<std::shared_ptr<DeltaBlock>> deltaBlocks;
+			MemOutputArchive out(lastDeltaBlocks, deltaBlocks, false);
+			out.serialize("replay", replay);
+			out.serialize("snapshotTimes", snapshotTimes);
+			auto buffer = std::move(out).releaseBuffer();
+
+			std::vector<BinarySavestate::StateRef> states;
+			states.push_back({.buffer = buffer, .deltaBlocks = deltaBlocks});
+			for (const auto* chunk : snapshots) {
+				states.push_back({.buffer = chunk->savestate, .deltaBlocks = chunk->deltaBlocks});
+			}
+			BinarySavestate::save(filename, states);
+		} else {
+			XmlOutputArchive out(filename);
+			out.serialize("replay", replay);
+			out.close();
+		}
 	} catch (MSXException&) {
 		if (addSentinel) {
 			history.events.pop_back();
@@ -650,6 +814,99 @@ void ReverseManager::saveReplay(
 	result = filename;
 }
 
+void ReverseManager::startStream(
+	Interpreter& interp, std::span<const TclObject> tokens, TclObject& result)
+{
+	std::string_view filenameArg;
+	double keyframeInterval = DEFAULT_KEYFRAME_INTERVAL;
+	std::array info = {valueArg("-keyframeinterval", keyframeInterval)};
+	auto args = parseTclArgs(interp, tokens.subspan(3), info);
+	switch (args.size()) {
+		case 0: break; // nothing
+		case 1: filenameArg = args[0].getString(); break;
+		default: throw SyntaxError();
+	}
+	if (keyframeInterval < SNAPSHOT_PERIOD) {
+		throw CommandException("Keyframe interval should be at least ",
+		                       SNAPSHOT_PERIOD, " second");
+	}
+
+	auto filename = FileOperations::parseCommandFileArgument(
+		filenameArg, REPLAY_DIR, "openmsx", REPLAY_EXTENSION);
+
+	start(); // (if not yet collecting)
+	closeStream();
+	auto stream = std::make_unique<ReplayStream>();
+	stream->keyframeInterval = keyframeInterval;
+	try {
+		stream->writer.open(filename);
+	} catch (MSXException& e) {
+		throw CommandException("Couldn't start replay stream: ", e.getMessage());
+	}
+	history.stream = std::move(stream);
+
+	// write the history collected so far
+	for (const auto& [seqNum, chunk] : history.chunks) {
+		streamSnapshot(chunk);
+	}
+	result = filename;
+}
+
+void ReverseManager::stopStream(TclObject& result)
+{
+	if (!history.stream) return;
+	auto filename = history.stream->writer.getFilename();
+	if (!closeStream()) {
+		throw CommandException("Error while writing replay stream ", filename);
+	}
+	result = filename;
+}
+
+bool ReverseManager::closeStream()
+{
+	if (!history.stream) return true;
+
+	// make sure the replay log ends with a EndLogEvent
+	bool addSentinel = history.events.empty() ||
+		!dynamic_cast<EndLogEvent*>(history.events.back().get());
+	if (addSentinel) {
+		history.events.push_back(std::make_unique<EndLogEvent>(
+			getCurrentTime()));
+	}
+	streamEvents();
+	if (addSentinel) {
+		history.events.pop_back();
+	}
+	bool ok = history.stream->writer.close();
+	history.stream.reset();
+	return ok;
+}
+
+void ReverseManager::streamEvents()
+{
+	auto& stream = *history.stream;
+	if (auto& t = stream.pendingTruncate) {
+		stream.writer.truncate(t->time, t->numEvents, t->reRecordCount);
+		t.reset();
+	}
+	stream.writer.addEvents(history.events, stream.numEvents);
+	stream.numEvents = history.events.size();
+}
+
+void ReverseManager::streamSnapshot(const ReverseChunk& chunk)
+{
+	// Events are written in batches, once per snapshot. So after a crash
+	// at most the events of the last SNAPSHOT_PERIOD are lost.
+	streamEvents();
+
+	// And only once in a while (per 'keyframeInterval') a keyframe.
+	auto& stream = *history.stream;
+	if (stream.keyframes.insert(stream.getKeyframeSeqNum(chunk.time)).second) {
+		stream.writer.addKeyframe(chunk.time, reRecordCount,
+		                          chunk.savestate, chunk.deltaBlocks);
+	}
+}
+
 void ReverseManager::loadReplay(
 	Interpreter& interp, std::span<const TclObject> tokens, TclObject& result)
 {
@@ -681,32 +938,82 @@ void ReverseManager::loadReplay(
 		throw e2;
 	}}}
 
+	// get destination time index
+	auto getDestination = [&](EmuTime saveTime) {
+		auto destination = EmuTime::zero();
+		if (!where || (*where == "begin")) {
+			destination = EmuTime::zero();
+		} else if (*where == "end") {
+			destination = EmuTime::infinity();
+		} else if (*where == "savetime") {
+			destination = saveTime;
+		} else {
+			destination += EmuDuration::sec(where->getDouble(interp));
+		}
+		return destination;
+	};
+
 	// restore replay
 	auto& reactor = motherBoard.getReactor();
 	Replay replay(reactor);
 	Events events;
 	replay.events = &events;
+	// only for binary replays and replay streams
+	std::vector<BinarySavestate::State> snapshotStates;
+	std::vector<EmuDuration> snapshotTimes; // relative to EmuTime::zero()
 	try {
-		XmlInputArchive in(filename);
-		in.serialize("replay", replay);
+		if (BinarySavestate::isBinarySavestate(filename)) {
+			auto states = BinarySavestate::load(filename);
+			MemInputArchive in(states[0].buffer, states[0].deltaBlocks);
+			in.serialize("replay", replay);
+			in.serialize("snapshotTimes", snapshotTimes);
+			if (snapshotTimes.empty() || (snapshotTimes.size() != (states.size() - 1))) {
+				throw MSXException("Invalid binary replay: mismatch in number of snapshots");
+			}
+			snapshotStates.assign(std::move_iterator(states.begin() + 1),
+			                      std::move_iterator(states.end()));
+		} else if (ReplayStreamReader::isReplayStream(filename)) {
+			ReplayStreamReader reader(filename);
+			swap(events, reader.getEvents());
+			if (events.empty() || !dynamic_cast<EndLogEvent*>(events.back().get())) {
+				// stream wasn't properly closed
+				events.push_back(std::make_unique<EndLogEvent>(reader.getEndTime()));
+			}
+			replay.currentTime = reader.getEndTime();
+			replay.reRecordCount = reader.getReRecordCount();
+
+			// Only decode the keyframes that are needed: the first
+			// one, the last one and the one right before the
+			// destination.
+			auto keyframes = reader.getKeyframes();
+			auto destination = getDestination(replay.currentTime);
+			auto it = std::ranges::upper_bound(keyframes, destination, {}, &ReplayStreamReader::Keyframe::time);
+			auto destIdx = size_t(std::max(it - keyframes.begin(), ptrdiff_t(1)) - 1);
+			for (auto i : {size_t(0), destIdx, keyframes.size() - 1}) {
+				auto time = keyframes[i].time - EmuTime::zero();
+				if (!snapshotTimes.empty() && (snapshotTimes.back() == time)) continue;
+				snapshotStates.push_back(reader.loadKeyframe(keyframes[i]));
+				snapshotTimes.push_back(time);
+			}
+		} else {
+			XmlInputArchive in(filename);
+			in.serialize("replay", replay);
+		}
+		if (!snapshotStates.empty()) {
+			// Only the first snapshot is needed as a machine, the
+			// others are used as-is for the new reverse history.
+			auto board = reactor.createEmptyMotherBoard();
+			MemInputArchive in(snapshotStates[0].buffer, snapshotStates[0].deltaBlocks);
+			in.serialize("machine", *board);
+			replay.motherBoards.push_back(std::move(board));
+		}
 	} catch (XMLException& e) {
 		throw CommandException("Cannot load replay, bad file format: ",
 		                       e.getMessage());
 	} catch (MSXException& e) {
 		throw CommandException("Cannot load replay: ", e.getMessage());
 	}
-
-	// get destination time index
-	auto destination = EmuTime::zero();
-	if (!where || (*where == "begin")) {
-		destination = EmuTime::zero();
-	} else if (*where == "end") {
-		destination = EmuTime::infinity();
-	} else if (*where == "savetime") {
-		destination = replay.currentTime;
-	} else {
-		destination += EmuDuration::sec(where->getDouble(interp));
-	}
+	auto destination = getDestination(replay.currentTime);
 
 	// OK, we are going to be actually changing states now
 
@@ -731,15 +1038,7 @@ void ReverseManager::loadReplay(
 
 	// Restore snapshots
 	unsigned replayIdx = 0;
-	for (const auto& m : replay.motherBoards) {
-		ReverseChunk newChunk;
-		newChunk.time = m->getCurrentTime();
-
-		MemOutputArchive out(newHistory.lastDeltaBlocks,
-		                     newChunk.deltaBlocks, false);
-		out.serialize("machine", *m);
-		newChunk.savestate = std::move(out).releaseBuffer();
-
+	auto addChunk = [&](ReverseChunk&& newChunk) {
 		// update replayIdx
 		// TODO: should we use <= instead??
 		while (replayIdx < newEvents.size() &&
@@ -750,6 +1049,27 @@ void ReverseManager::loadReplay(
 
 		newHistory.chunks[newHistory.getNextSeqNum(newChunk.time)] =
 			std::move(newChunk);
+	};
+	if (snapshotStates.empty()) {
+		for (const auto& m : replay.motherBoards) {
+			ReverseChunk newChunk;
+			newChunk.time = m->getCurrentTime();
+
+			MemOutputArchive out(newHistory.lastDeltaBlocks,
+			                     newChunk.deltaBlocks, false);
+			out.serialize("machine", *m);
+			newChunk.savestate = std::move(out).releaseBuffer();
+			addChunk(std::move(newChunk));
+		}
+	} else {
+		for (auto i : xrange(snapshotTimes.size())) {
+			auto& state = snapshotStates[i];
+			ReverseChunk newChunk;
+			newChunk.time = EmuTime::zero() + snapshotTimes[i];
+			newChunk.savestate = std::move(state.buffer);
+			newChunk.deltaBlocks = std::move(state.deltaBlocks);
+			addChunk(std::move(newChunk));
+		}
 	}
 
 	// Note: until this point we didn't make any changes to the current
@@ -785,6 +1105,207 @@ void ReverseManager::transferHistory(ReverseHistory& oldHistory,
 	replayNextEvent();
 }
 
+void ReverseManager::requestPreRoll(double time)
+{
+	if (!isCollecting()) return;
+	if (!preRollTarget) preRollSeqNumSince = Timer::getTime(); // new request
+	preRollTarget = EmuTime::zero() + EmuDuration::sec(std::max(time, 0.0));
+	if (!preRollStep.isPendingRT()) {
+		preRollStep.scheduleRT(0);
+	}
+}
+
+// Called on the (hidden) pre-roll board: replay the given events, but don't
+// take snapshots.
+void ReverseManager::replayPreRollEvents(Events&& events)
+{
+	assert(!isCollecting());
+	assert(!events.empty());
+	history.events = std::move(events);
+	collecting = true; // so that stop() cleans up
+	auto& distributor = motherBoard.getStateChangeDistributor();
+	distributor.registerRecorder(*this);
+	distributor.setViewOnlyMode(true);
+	replayIndex = 0;
+	replayNextEvent();
+}
+
+/* Pre-roll: emulate a hidden board from the snapshot before the target time
+ * up to that time. This is the same work as 'reverse goto' does, but spread
+ * over small time slices, so it can be done speculatively. It results in a
+ * new snapshot at the target time. The board itself is kept as well, a goto
+ * can continue from it and later pre-roll requests to later times too.
+ * Creating the board is the expensive part, so it's only done when the target
+ * stays after the same snapshot for a while (the target typically changes
+ * every frame while the mouse moves), and the board is reused as long as the
+ * target stays after that snapshot.
+ *
+ * Note: the emulation core is single-threaded (e.g. creating a board
+ * registers Tcl commands and settings), so this is done in the main thread.
+ */
+void ReverseManager::stepPreRoll()
+{
+	if (!preRollTarget || !isCollecting()) return;
+	if (preRoll && (preRoll->generation != historyGeneration)) {
+		preRoll.reset(); // event log was changed
+	}
+
+	auto endTime = getEndTime(history);
+	auto target = std::clamp(*preRollTarget, begin(history.chunks)->second.time, endTime);
+	if ((endTime - target) < PRE_ROLL_STEP) {
+		// Too close to the end, there the board would stop replaying.
+		preRollTarget.reset();
+		return;
+	}
+	auto it = std::ranges::find_if(history.chunks | std::views::reverse, [&](auto& p) {
+		return p.second.time <= target;
+	});
+	assert(it != std::ranges::rend(history.chunks)); // first one is not newer
+	const auto& [seqNum, chunk] = *it;
+	if ((target - chunk.time) < EmuDuration::sec(snapshotPeriod)) {
+		// close enough, nothing (more) to do
+		preRollTarget.reset();
+		return;
+	}
+	auto now = Timer::getTime();
+	if (seqNum != preRollSeqNum) {
+		preRollSeqNum = seqNum;
+		preRollSeqNumSince = now;
+	}
+	try {
+		// The board can be reused when it started before the target,
+		// and it's not before the snapshot the target would start from
+		// (otherwise it's faster to restart from that snapshot).
+		bool reuse = preRoll &&
+		             preRoll->board->getReverseManager().isReplaying() &&
+		             (preRoll->startTime <= target) &&
+		             (chunk.time <= preRoll->board->getCurrentTime()) &&
+		             (target < preRoll->endTime);
+		if (!reuse) {
+			if ((now - preRollSeqNumSince) < PRE_ROLL_DELAY) {
+				// wait till the target settles down
+				preRollStep.scheduleRT(PRE_ROLL_INTERVAL);
+				return;
+			}
+			// Restoring the snapshot is the first slice.
+			preRoll.reset();
+			startPreRoll(chunk);
+		} else if (preRoll->board->getCurrentTime() >= target) {
+			// Already past the target (it moved back, but not
+			// before the snapshot). A goto to the target replays
+			// from 'chunk', that's less than what the board
+			// already did, so keep the board for later requests.
+			preRollTarget.reset();
+			return;
+		} else {
+			auto& board = *preRoll->board;
+			auto start = Timer::getTime();
+			while ((board.getCurrentTime() < target) &&
+			       ((Timer::getTime() - start) < PRE_ROLL_SLICE)) {
+				board.fastForward(std::min(target, board.getCurrentTime() + PRE_ROLL_STEP), true);
+			}
+			if (board.getCurrentTime() >= target) {
+				addPreRollSnapshot();
+				preRollTarget.reset();
+				return;
+			}
+		}
+	} catch (MSXException&) {
+		// just give up, this is only an optimization
+		preRoll.reset();
+		preRollTarget.reset();
+		return;
+	}
+	preRollStep.scheduleRT(PRE_ROLL_INTERVAL);
+}
+
+void ReverseManager::startPreRoll(const ReverseChunk& chunk)
+{
+	auto& reactor = motherBoard.getReactor();
+	auto newPreRoll = std::make_unique<PreRoll>();
+	newPreRoll->board = reactor.createEmptyMotherBoard();
+	newPreRoll->firstEvent = chunk.eventCount;
+	newPreRoll->startTime = chunk.time;
+	newPreRoll->endTime = getEndTime(history);
+	newPreRoll->generation = historyGeneration;
+	auto& board = *newPreRoll->board;
+	board.getMSXCliComm().setSuppressMessages(true);
+	MemInputArchive in(chunk.savestate, chunk.deltaBlocks);
+	in.serialize("machine", board);
+
+	// The board gets its own copy of the events (from the snapshot on),
+	// made via a serialize round trip.
+	LastDeltaBlocks lastDeltaBlocks;
+	std::vector<std::shared_ptr<DeltaBlock>> deltaBlocks;
+	MemOutputArchive out(lastDeltaBlocks, deltaBlocks, false);
+	const auto& events = history.events;
+	for (auto i : xrange(size_t(chunk.eventCount), events.size())) {
+		out.serialize("event", events[i]);
+	}
+	auto buffer = std::move(out).releaseBuffer();
+	MemInputArchive in2(buffer, deltaBlocks);
+	Events copy;
+	for ([[maybe_unused]] auto i : xrange(size_t(chunk.eventCount), events.size())) {
+		std::unique_ptr<StateChange> event;
+		in2.serialize("event", event);
+		copy.push_back(std::move(event));
+	}
+	if (copy.empty() || !dynamic_cast<const EndLogEvent*>(copy.back().get())) {
+		copy.push_back(std::make_unique<EndLogEvent>(newPreRoll->endTime));
+	}
+	board.getReverseManager().replayPreRollEvents(std::move(copy));
+
+	// The hidden board counts for the memory budget. Its size is
+	// dominated by the emulated memories, so estimate it via the size of
+	// the snapshot it was loaded from.
+	newPreRoll->memoryUsage = chunk.savestate.size();
+	for (const auto& block : chunk.deltaBlocks) {
+		newPreRoll->memoryUsage += block->getSize();
+	}
+	preRoll = std::move(newPreRoll);
+	enforceMemoryBudget(getCurrentTime());
+}
+
+void ReverseManager::addPreRollSnapshot()
+{
+	auto& board = *preRoll->board;
+	const auto& manager = board.getReverseManager();
+	// When the board did reach the end of its events, the main event log
+	// might contain newer events that it didn't replay.
+	if (!manager.isReplaying()) return;
+
+	auto time = board.getCurrentTime();
+	unsigned seqNum = history.getNextSeqNum(time);
+	if (history.chunks.contains(seqNum)) return;
+
+	ReverseChunk& newChunk = history.chunks[seqNum];
+	MemOutputArchive out(preRoll->lastDeltaBlocks, newChunk.deltaBlocks, true);
+	out.serialize("machine", board);
+	newChunk.time = time;
+	newChunk.savestate = std::move(out).releaseBuffer();
+	newChunk.eventCount = preRoll->firstEvent + manager.replayIndex;
+
+	enforceMemoryBudget(getCurrentTime());
+}
+
+// Returns the pre-rolled board when it's a better starting point for 'reverse
+// goto' than the snapshot at 'snapshotTime', otherwise nullptr.
+std::shared_ptr<MSXMotherBoard> ReverseManager::takePreRolledBoard(
+	EmuTime snapshotTime, EmuTime preTarget, unsigned& eventCount)
+{
+	if (!preRoll || (preRoll->generation != historyGeneration)) return {};
+	auto& manager = preRoll->board->getReverseManager();
+	auto time = preRoll->board->getCurrentTime();
+	if (!manager.isReplaying() || (time <= snapshotTime) || (time > preTarget)) return {};
+
+	eventCount = preRoll->firstEvent + manager.replayIndex;
+	manager.stop(); // the caller transfers the real history
+	auto result = std::move(preRoll->board);
+	preRoll.reset();
+	preRollTarget.reset();
+	return result;
+}
+
 void ReverseManager::execNewSnapshot()
 {
 	// During record we should take regular snapshots, and 'now'
@@ -862,13 +1383,37 @@ unsigned ReverseManager::ReverseHistory::getNextSeqNum(EmuTime time) const
 	return narrow<unsigned>(lrint(duration / SNAPSHOT_PERIOD));
 }
 
+size_t ReverseManager::ReverseHistory::getMemoryUsage() const
+{
+	// DeltaBlocks can be shared between snapshots and can refer to other
+	// blocks, count each block only once.
+	std::unordered_set<const DeltaBlock*> seen;
+	size_t result = 0;
+	for (const auto& [idx, chunk] : chunks) {
+		result += chunk.savestate.size();
+		for (const auto& block : chunk.deltaBlocks) {
+			for (const auto* b = block.get(); b && seen.insert(b).second; b = b->getReference()) {
+				result += b->getMemoryUsage();
+			}
+		}
+	}
+	return result;
+}
+
 void ReverseManager::takeSnapshot(EmuTime time)
 {
 	// (possibly) drop old snapshots
 	// TODO does snapshot pruning still happen correctly (often enough)
 	//      when going back/forward in time?
 	unsigned seqNum = history.getNextSeqNum(time);
-	dropOldSnapshots<25>(seqNum);
+	// When snapshots are taken less often than once per SNAPSHOT_PERIOD,
+	// also thin for the skipped sequence numbers. This keeps the same
+	// distribution over time.
+	unsigned firstSeqNum = history.chunks.empty() ? seqNum
+	                     : std::min(seqNum, history.chunks.rbegin()->first + 1);
+	for (auto count : xrange(firstSeqNum, seqNum + 1)) {
+		dropOldSnapshots<25>(count);
+	}
 
 	// During replay we might already have a snapshot with the current
 	// sequence number, though this snapshot does not necessarily have the
@@ -883,6 +1428,64 @@ void ReverseManager::takeSnapshot(EmuTime time)
 	newChunk.time = time;
 	newChunk.savestate = std::move(out).releaseBuffer();
 	newChunk.eventCount = replayIndex;
+
+	if (history.stream) streamSnapshot(newChunk);
+
+	enforceMemoryBudget(time);
+}
+
+/* Drop snapshots (when needed) to keep the memory usage under the budget,
+ * and adapt the snapshot period to the snapshot size.
+ *
+ * The snapshot that's dropped is the one that leaves the smallest gap,
+ * relative to its distance to the current time. So distant history gets
+ * thinned first, like in dropOldSnapshots(). The first and the last snapshot
+ * are never dropped.
+ */
+void ReverseManager::enforceMemoryBudget(EmuTime time)
+{
+	auto budget = size_t(memoryBudgetSetting.getInt()) * 1024 * 1024;
+	if (budget == 0) {
+		snapshotPeriod = SNAPSHOT_PERIOD;
+		return;
+	}
+
+	auto& chunks = history.chunks;
+	auto toSec = [](EmuTime t) { return (t - EmuTime::zero()).toDouble(); };
+	double now = toSec(time);
+	size_t usage = history.getMemoryUsage();
+	size_t preRollUsage = preRoll ? preRoll->memoryUsage : 0;
+	while (((usage + preRollUsage) > budget) && (chunks.size() > 2)) {
+		auto victim = end(chunks);
+		double victimCost = std::numeric_limits<double>::infinity();
+		for (auto it = std::next(begin(chunks)); std::next(it) != end(chunks); ++it) {
+			double gap = toSec(std::next(it)->second.time) - toSec(std::prev(it)->second.time);
+			double dist = std::abs(toSec(it->second.time) - now) + SNAPSHOT_PERIOD;
+			if (double cost = gap / dist; cost < victimCost) {
+				victim = it;
+				victimCost = cost;
+			}
+		}
+		chunks.erase(victim);
+		usage = history.getMemoryUsage();
+	}
+
+	// Take snapshots less often when only a few of them fit in the budget.
+	double avgSize = double(usage) / double(chunks.size());
+	double period = SNAPSHOT_PERIOD * NOF_BUDGET_SNAPSHOTS * avgSize / double(budget);
+	snapshotPeriod = std::clamp(period, SNAPSHOT_PERIOD, getMaxSnapshotPeriod());
+}
+
+double ReverseManager::getMaxSnapshotPeriod() const
+{
+	// Replaying the time between two snapshots (roughly the worst case
+	// for 'reverse goto') shouldn't take longer than MAX_REPLAY_TIME.
+	double result = MAX_SNAPSHOT_PERIOD;
+	if (replayStats.hostTime > 0.0) {
+		double replaySpeed = replayStats.emuTime / replayStats.hostTime;
+		result = std::min(result, MAX_REPLAY_TIME * replaySpeed);
+	}
+	return std::max(result, SNAPSHOT_PERIOD);
 }
 
 void ReverseManager::replayNextEvent()
@@ -914,6 +1517,25 @@ void ReverseManager::stopReplay(EmuTime time) noexcept
 		history.chunks.erase(it, end(history.chunks));
 		// this also means someone is changing history, record that
 		reRecordCount++;
+		historyGeneration++; // (pre-roll board is destroyed later)
+		if (auto& stream = history.stream) {
+			// Only remember it here, this method may not throw. Until
+			// it's written nothing else is added to the stream, so
+			// several truncates can be combined.
+			auto& t = stream->pendingTruncate;
+			if (t) {
+				t->time = std::min(t->time, time);
+				t->numEvents = std::min(t->numEvents, size_t(replayIndex));
+				t->reRecordCount = reRecordCount;
+			} else {
+				t = ReplayStream::Truncate{.time = time, .numEvents = replayIndex,
+				                           .reRecordCount = reRecordCount};
+			}
+			stream->numEvents = std::min(stream->numEvents, size_t(replayIndex));
+			// (conservatively) forget the keyframes after 'time'
+			stream->keyframes.erase(stream->keyframes.lower_bound(stream->getKeyframeSeqNum(time)),
+			                        stream->keyframes.end());
+		}
 	}
 	assert(!isReplaying());
 }
@@ -947,7 +1569,7 @@ void ReverseManager::dropOldSnapshots(unsigned count)
 
 void ReverseManager::schedule(EmuTime time)
 {
-	syncNewSnapshot.setSyncPoint(time + EmuDuration::sec(SNAPSHOT_PERIOD));
+	syncNewSnapshot.setSyncPoint(time + EmuDuration::sec(snapshotPeriod));
 }
 
 
@@ -968,10 +1590,20 @@ void ReverseManager::ReverseCmd::execute(std::span<const TclObject> tokens, TclO
 		"stop",       [&]{ manager.stop(); },
 		"status",     [&]{ manager.status(result); },
 		"debug",      [&]{ manager.debugInfo(result); },
+		"preroll",    [&]{
+			checkNumArgs(tokens, 3, "time");
+			manager.requestPreRoll(tokens[2].getDouble(getInterpreter()));
+			},
 		"goback",     [&]{ manager.goBack(tokens); },
 		"goto",       [&]{ manager.goTo(tokens); },
 		"savereplay", [&]{ manager.saveReplay(interp, tokens, result); },
 		"loadreplay", [&]{ manager.loadReplay(interp, tokens, result); },
+		"stream", [&]{
+			checkNumArgs(tokens, AtLeast{3}, "start|stop ?arg ...?");
+			executeSubCommand(tokens[2].getString(),
+				"start", [&]{ manager.startStream(interp, tokens, result); },
+				"stop",  [&]{ manager.stopStream(result); });
+			},
 		"viewonlymode", [&]{
 			auto& distributor = manager.motherBoard.getStateChangeDistributor();
 			switch (tokens.size()) {
@@ -997,10 +1629,13 @@ std::string ReverseManager::ReverseCmd::help(std::span<const TclObject> /*tokens
 	       "status              show various status info on reverse\n"
 	       "goback <n>          go back <n> seconds in time\n"
 	       "goto <time>         go to an absolute moment in time\n"
+	       "preroll <time>      prepare (in the background) for a goto to the given time\n"
 	       "viewonlymode <bool> switch viewonly mode on or off\n"
 	       "truncatereplay      stop replaying and remove all 'future' data\n"
-	       "savereplay [<name>] save the first snapshot and all replay data as a 'replay' (with optional name)\n"
-	       "loadreplay [-goto <begin|end|savetime|<n>>] [-viewonly] <name>   load a replay (snapshot and replay data) with given name and start replaying\n";
+	       "savereplay [-maxnofextrasnapshots <n>] [-binary] [<name>]   save the first snapshot and all replay data as a 'replay' (with optional name), -binary uses a format that's faster to save and load, but that can only be loaded by the same openMSX version\n"
+	       "loadreplay [-goto <begin|end|savetime|<n>>] [-viewonly] <name>   load a replay (snapshot and replay data) with given name and start replaying\n"
+	       "stream start [-keyframeinterval <seconds>] [<name>]   start writing the replay to file while it's being recorded, 'savereplay' without name then only flushes this file\n"
+	       "stream stop         finish writing the replay stream\n";
 }
 
 void ReverseManager::ReverseCmd::tabCompletion(std::vector<std::string>& tokens) const
@@ -1009,8 +1644,8 @@ void ReverseManager::ReverseCmd::tabCompletion(std::vector<std::string>& tokens)
 	if (tokens.size() == 2) {
 		static constexpr std::array subCommands = {
 			"start"sv, "stop"sv, "status"sv, "goback"sv, "goto"sv,
-			"savereplay"sv, "loadreplay"sv, "viewonlymode"sv,
-			"truncatereplay"sv,
+			"preroll"sv, "savereplay"sv, "loadreplay"sv, "viewonlymode"sv,
+			"truncatereplay"sv, "stream"sv,
 		};
 		completeString(tokens, subCommands);
 	} else if ((tokens.size() == 3) || (tokens[1] == "loadreplay")) {
@@ -1021,6 +1656,9 @@ void ReverseManager::ReverseCmd::tabCompletion(std::vector<std::string>& tokens)
 		} else if (tokens[1] == "viewonlymode") {
 			static constexpr std::array options = {"true"sv, "false"sv};
 			completeString(tokens, options);
+		} else if (tokens[1] == "stream") {
+			static constexpr std::array options = {"start"sv, "stop"sv};
+			completeString(tokens, options);
 		}
 	}
 }
@@ -4,6 +4,8 @@
 #include "Command.hh"
 #include "EmuTime.hh"
 #include "EventListener.hh"
+#include "IntegerSetting.hh"
+#include "RTSchedulable.hh"
 #include "Schedulable.hh"
 
 #include "DeltaBlock.hh"
@@ -14,6 +16,7 @@
 #include <deque>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <span>
 #include <string_view>
@@ -74,6 +77,15 @@ public:
 		});
 	}
 
+	/** Speculatively prepare for a 'reverse goto' to the given time (in
+	  * seconds), e.g. while the mouse hovers over the reverse bar. In the
+	  * background (in small time slices) a snapshot close to that time is
+	  * created, so that a later goto to (around) that time is fast. This
+	  * can be called often (e.g. each frame), it only really starts once
+	  * the target settles down.
+	  */
+	void requestPreRoll(double time);
+
 private:
 	struct ReverseChunk {
 		EmuTime time = EmuTime::zero();
@@ -88,14 +100,20 @@ private:
 	using Chunks = std::map<unsigned, ReverseChunk>;
 	using Events = std::deque<std::unique_ptr<StateChange>>;
 
+	struct ReplayStream; // see ReverseManager.cc
+	struct PreRoll;      // see ReverseManager.cc
+
 	struct ReverseHistory {
 		void swap(ReverseHistory& other) noexcept;
 		void clear();
 		[[nodiscard]] unsigned getNextSeqNum(EmuTime time) const;
+		/** Bytes used by the snapshots (savestates and DeltaBlocks). */
+		[[nodiscard]] size_t getMemoryUsage() const;
 
 		Chunks chunks;
 		Events events;
 		LastDeltaBlocks lastDeltaBlocks;
+		std::unique_ptr<ReplayStream> stream; // only while streaming
 	};
 
 	void start();
@@ -104,10 +122,18 @@ private:
 	void debugInfo(TclObject& result) const;
 	void goBack(std::span<const TclObject> tokens);
 	void goTo(std::span<const TclObject> tokens);
+	[[nodiscard]] std::vector<const ReverseChunk*> selectReplaySnapshots(
+		int maxNofExtraSnapshots) const;
 	void saveReplay(Interpreter& interp,
 	                std::span<const TclObject> tokens, TclObject& result);
 	void loadReplay(Interpreter& interp,
 	                std::span<const TclObject> tokens, TclObject& result);
+	void startStream(Interpreter& interp,
+	                 std::span<const TclObject> tokens, TclObject& result);
+	void stopStream(TclObject& result);
+	bool closeStream();
+	void streamEvents();
+	void streamSnapshot(const ReverseChunk& chunk);
 
 	void signalStopReplay(EmuTime time);
 	[[nodiscard]] EmuTime getEndTime(const ReverseHistory& history) const;
@@ -118,6 +144,14 @@ private:
 	                     unsigned oldEventCount);
 	void transferState(MSXMotherBoard& newBoard);
 	void takeSnapshot(EmuTime time);
+	void replayPreRollEvents(Events&& events);
+	void stepPreRoll();
+	void startPreRoll(const ReverseChunk& chunk);
+	void addPreRollSnapshot();
+	[[nodiscard]] std::shared_ptr<MSXMotherBoard> takePreRolledBoard(
+		EmuTime snapshotTime, EmuTime preTarget, unsigned& eventCount);
+	void enforceMemoryBudget(EmuTime time);
+	[[nodiscard]] double getMaxSnapshotPeriod() const;
 	void schedule(EmuTime time);
 	void replayNextEvent();
 	template<unsigned N> void dropOldSnapshots(unsigned count);
@@ -140,6 +174,15 @@ private:
 		}
 	} syncInputEvent;
 
+	// RTSchedulable
+	struct PreRollStep final : RTSchedulable {
+		explicit PreRollStep(RTScheduler& s) : RTSchedulable(s) {}
+		void executeRT() override {
+			auto& rm = OUTER(ReverseManager, preRollStep);
+			rm.stepPreRoll();
+		}
+	} preRollStep;
+
 	void execNewSnapshot();
 	void execInputEvent();
 	[[nodiscard]] EmuTime getCurrentTime() const { return syncNewSnapshot.getCurrentTime(); }
@@ -158,6 +201,8 @@ private:
 		void tabCompletion(std::vector<std::string>& tokens) const override;
 	} reverseCmd;
 
+	IntegerSetting memoryBudgetSetting; // in MB
+
 	EventDelay* eventDelay = nullptr;
 	ReverseHistory history;
 	unsigned replayIndex = 0;
@@ -166,6 +211,27 @@ private:
 
 	unsigned reRecordCount = 0;
 
+	// Time between two snapshots, larger than SNAPSHOT_PERIOD when the
+	// snapshots don't fit the memory budget.
+	double snapshotPeriod;
+
+	// Statistics of the replay phase of 'reverse goto' (in seconds).
+	struct ReplayStats {
+		unsigned count = 0;
+		double hostTime = 0.0;
+		double emuTime = 0.0;
+	} replayStats;
+
+	std::unique_ptr<PreRoll> preRoll;
+	std::optional<EmuTime> preRollTarget;
+	// The snapshot the pre-roll target would start from, and since when
+	// (host time in us) that's the case, see stepPreRoll().
+	unsigned preRollSeqNum = 0;
+	uint64_t preRollSeqNumSince = 0;
+	// Increased each time (part of) the event log is removed, this
+	// invalidates a pre-roll that's in progress.
+	unsigned historyGeneration = 0;
+
 	friend struct Replay;
 };
 
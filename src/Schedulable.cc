@@ -9,11 +9,13 @@ namespace openmsx {
 Schedulable::Schedulable(Scheduler& scheduler_)
 	: scheduler(scheduler_)
 {
+	scheduler.registerSchedulable(*this);
 }
 
 Schedulable::~Schedulable()
 {
 	removeSyncPoints();
+	scheduler.unregisterSchedulable(*this);
 }
 
 void Schedulable::schedulerDeleted()
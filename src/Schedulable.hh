@@ -6,6 +6,7 @@
 #include "serialize_meta.hh"
 #include "serialize_stl.hh"
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 namespace openmsx {
@@ -101,6 +102,12 @@ protected:
 
 private:
 	Scheduler& scheduler;
+
+	// Maintained by the Scheduler.
+	friend class Scheduler;
+	unsigned numSyncPoints = 0; // number of pending sync points
+	uint64_t numScheduled = 0;  // statistics, see Scheduler::getStats()
+	uint64_t numExecuted = 0;
 };
 REGISTER_BASE_CLASS(Schedulable, "Schedulable");
 
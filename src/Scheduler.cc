@@ -1,5 +1,6 @@
 #include "Scheduler.hh"
 
+#include "HostTimeProfile.hh"
 #include "MSXCPU.hh"
 #include "Schedulable.hh"
 #include "Thread.hh"
@@ -9,7 +10,15 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <iterator> // for back_inserter
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <typeinfo>
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
 
 namespace openmsx {
 
@@ -37,6 +46,9 @@ void Scheduler::setSyncPoint(EmuTime time, Schedulable& device)
 	assert(Thread::isMainThread());
 	assert(time >= scheduleTime);
 
+	++device.numSyncPoints;
+	++device.numScheduled;
+
 	// Push sync point into queue.
 	queue.insert(SynchronizationPoint(time, &device),
 	             [](SynchronizationPoint& sp) { sp.setTime(EmuTime::infinity()); },
@@ -54,32 +66,40 @@ void Scheduler::setSyncPoint(EmuTime time, Schedulable& device)
 Scheduler::SyncPoints Scheduler::getSyncPoints(const Schedulable& device) const
 {
 	SyncPoints result;
+	if (device.numSyncPoints == 0) return result;
 	std::ranges::copy_if(queue, back_inserter(result), EqualSchedulable(device));
+	assert(result.size() == device.numSyncPoints);
 	return result;
 }
 
-bool Scheduler::removeSyncPoint(const Schedulable& device)
+bool Scheduler::removeSyncPoint(Schedulable& device)
 {
 	assert(Thread::isMainThread());
-	return queue.remove(EqualSchedulable(device));
+	if (device.numSyncPoints == 0) return false;
+	[[maybe_unused]] bool removed = queue.remove(EqualSchedulable(device));
+	assert(removed);
+	--device.numSyncPoints;
+	return true;
 }
 
-void Scheduler::removeSyncPoints(const Schedulable& device)
+void Scheduler::removeSyncPoints(Schedulable& device)
 {
 	assert(Thread::isMainThread());
+	if (device.numSyncPoints == 0) return;
 	queue.remove_all(EqualSchedulable(device));
+	device.numSyncPoints = 0;
 }
 
 bool Scheduler::pendingSyncPoint(const Schedulable& device,
                                  EmuTime& result) const
 {
 	assert(Thread::isMainThread());
-	if (auto it = std::ranges::find(queue, &device, &SynchronizationPoint::getDevice);
-	    it != std::end(queue)) {
-		result = it->getTime();
-		return true;
-	}
-	return false;
+	if (device.numSyncPoints == 0) return false;
+	// The queue is sorted, so this finds the earliest one.
+	auto it = std::ranges::find(queue, &device, &SynchronizationPoint::getDevice);
+	assert(it != std::end(queue));
+	result = it->getTime();
+	return true;
 }
 
 EmuTime Scheduler::getCurrentTime() const
@@ -91,6 +111,7 @@ EmuTime Scheduler::getCurrentTime() const
 void Scheduler::scheduleHelper(EmuTime limit, EmuTime next)
 {
 	assert(!scheduleInProgress);
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::SCHEDULER);
 	scheduleInProgress = true;
 	while (true) {
 		assert(scheduleTime <= next);
@@ -100,6 +121,8 @@ void Scheduler::scheduleHelper(EmuTime limit, EmuTime next)
 		auto* device = sp.getDevice();
 
 		queue.remove_front();
+		--device->numSyncPoints;
+		++device->numExecuted;
 
 		device->executeUntil(next);
 
@@ -111,6 +134,62 @@ void Scheduler::scheduleHelper(EmuTime limit, EmuTime next)
 	cpu->setNextSyncPoint(next);
 }
 
+void Scheduler::registerSchedulable(Schedulable& schedulable)
+{
+	schedulables.push_back(&schedulable);
+}
+
+void Scheduler::unregisterSchedulable(Schedulable& schedulable)
+{
+	move_pop_back(schedulables, rfind_unguarded(schedulables, &schedulable));
+}
+
+[[nodiscard]] static std::string getTypeName(const Schedulable& schedulable)
+{
+	const char* name = typeid(schedulable).name();
+	std::string result = name;
+#if __has_include(<cxxabi.h>)
+	int status = 0;
+	std::unique_ptr<char, decltype(&free)> demangled(
+		abi::__cxa_demangle(name, nullptr, nullptr, &status), &free);
+	if (status == 0) result = demangled.get();
+#endif
+	static constexpr std::string_view NS = "openmsx::";
+	for (auto pos = result.find(NS); pos != std::string::npos; pos = result.find(NS, pos)) {
+		result.erase(pos, NS.size());
+	}
+	return result;
+}
+
+std::vector<Scheduler::Stats> Scheduler::getStats() const
+{
+	std::vector<Stats> result;
+	for (const auto* s : schedulables) {
+		auto name = getTypeName(*s);
+		auto it = std::ranges::find(result, name, &Stats::name);
+		if (it == result.end()) {
+			it = result.insert(it, Stats{.name = std::move(name)});
+		}
+		++it->instances;
+		it->scheduled += s->numScheduled;
+		it->executed += s->numExecuted;
+	}
+	std::ranges::sort(result, [](const Stats& x, const Stats& y) {
+		return std::tie(y.executed, y.scheduled, x.name) <
+		       std::tie(x.executed, x.scheduled, y.name);
+	});
+	return result;
+}
+
+void Scheduler::resetStats()
+{
+	for (auto* s : schedulables) {
+		s->numScheduled = 0;
+		s->numExecuted = 0;
+	}
+	statsStartTime = scheduleTime;
+}
+
 
 template<typename Archive>
 void SynchronizationPoint::serialize(Archive& ar, unsigned /*version*/)
@@ -3,6 +3,8 @@
 
 #include "EmuTime.hh"
 #include "SchedulerQueue.hh"
+#include <cstdint>
+#include <string>
 #include <vector>
 
 namespace openmsx {
@@ -66,12 +68,32 @@ public:
 		scheduleTime = limit;
 	}
 
+	/** Per type of Schedulable, how often sync points were scheduled
+	  * and executed since the last resetStats(). Each executed sync point
+	  * interrupts the CPU emulation loop, so a high rate can be a reason
+	  * for slow emulation.
+	  */
+	struct Stats {
+		std::string name; // (demangled) C++ type name
+		unsigned instances = 0;
+		uint64_t scheduled = 0;
+		uint64_t executed = 0;
+	};
+	/** Sorted from most to least executed sync points. */
+	[[nodiscard]] std::vector<Stats> getStats() const;
+	/** The emulated time from which getStats() counts. */
+	[[nodiscard]] EmuTime getStatsStartTime() const { return statsStartTime; }
+	void resetStats();
+
 	template<typename Archive>
 	void serialize(Archive& ar, unsigned version);
 
 private: // -> intended for Schedulable
 	friend class Schedulable;
 
+	void registerSchedulable(Schedulable& schedulable);
+	void unregisterSchedulable(Schedulable& schedulable);
+
 	/**
 	 * Register a syncPoint. When the emulation reaches "timestamp",
 	 * the executeUntil() method of "device" gets called.
@@ -92,14 +114,16 @@ private: // -> intended for Schedulable
 	 * removed.
 	 * Returns false <=> if there was no match (so nothing removed)
 	 */
-	bool removeSyncPoint(const Schedulable& device);
+	bool removeSyncPoint(Schedulable& device);
 
 	/** Remove all sync-points for the given device.
 	  */
-	void removeSyncPoints(const Schedulable& device);
+	void removeSyncPoints(Schedulable& device);
 
 	/**
 	 * Is there a pending syncPoint for this device?
+	 * The (common) case without pending syncPoints doesn't need to
+	 * search the queue, this also holds for the two methods above.
 	 */
 	[[nodiscard]] bool pendingSyncPoint(const Schedulable& device, EmuTime& result) const;
 
@@ -111,7 +135,9 @@ private:
 	  * doesn't allow removal of non-top element.
 	  */
 	SchedulerQueue<SynchronizationPoint> queue;
+	std::vector<Schedulable*> schedulables; // all, also without sync points
 	EmuTime scheduleTime = EmuTime::zero();
+	EmuTime statsStartTime = EmuTime::zero();
 	MSXCPU* cpu = nullptr;
 	bool scheduleInProgress = false;
 };
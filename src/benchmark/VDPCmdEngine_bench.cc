@@ -0,0 +1,305 @@
+// Benchmark for the VDP command engine.
+//
+// This creates a machine that only contains a V9968 VDP (see
+// machines/VDPCmdEngine_bench.xml next to this file) and runs commands
+// through the real VDPCmdEngine and VDPVRAM: commands are started by
+// writing the VDP registers, and the engine is synced while the emulated
+// time advances, like during normal emulation. Transfer commands (LMCM,
+// LMMC, HMMC) are fed by a CPU that polls S#2 at about the speed of an
+// OTIR loop.
+// For every command x mode x logical operation x HS/non-HS x EVR on/off
+// combination it reports the host time per pixel and the number of
+// emulated VDP ticks the commands took.
+//
+// The machine config is found through the OPENMSX_USER_DATA environment
+// variable, 'meson test --benchmark' sets it up.
+//
+// Usage: benchmark [<repetitions>]
+
+#include "MSXMotherBoard.hh"
+#include "Reactor.hh"
+#include "Scheduler.hh"
+#include "VDP.hh"
+#include "VDPCmdEngine.hh"
+#include "VDPVRAM.hh"
+
+#include "BooleanSetting.hh"
+#include "GlobalCommandController.hh"
+#include "MSXException.hh"
+#include "RealTime.hh"
+#include "SettingsConfig.hh"
+#include "Thread.hh"
+
+#include "checked_cast.hh"
+#include "xrange.hh"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace openmsx {
+
+struct ModeInfo {
+	std::string_view name;
+	uint8_t r0; // mode bits M3-M5
+	uint8_t r25; // CMD bit: allow commands in non-bitmap modes
+	unsigned pixelsPerLine;
+};
+
+static constexpr auto modes = std::array{
+	ModeInfo{"G4", 0x06, 0x00, 256},
+	ModeInfo{"G5", 0x08, 0x00, 512},
+	ModeInfo{"G6", 0x0A, 0x00, 512},
+	ModeInfo{"G7", 0x0E, 0x00, 256},
+	ModeInfo{"NB", 0x00, 0x40, 256}, // GRAPHIC1
+};
+
+enum class Kind : uint8_t {
+	POINT, PSET, SRCH, LINE, BLOCK, TO_CPU, FROM_CPU
+};
+
+struct CommandInfo {
+	std::string_view name;
+	uint8_t cmd;  // upper nibble of the CMD register
+	bool logical; // does the command use a logical operation
+	Kind kind;
+};
+
+static constexpr auto commands = std::array{
+	CommandInfo{"POINT", 0x4, false, Kind::POINT},
+	CommandInfo{"PSET",  0x5, true,  Kind::PSET},
+	CommandInfo{"SRCH",  0x6, false, Kind::SRCH},
+	CommandInfo{"LINE",  0x7, true,  Kind::LINE},
+	CommandInfo{"LMMV",  0x8, true,  Kind::BLOCK},
+	CommandInfo{"LMMM",  0x9, true,  Kind::BLOCK},
+	CommandInfo{"LMCM",  0xA, false, Kind::TO_CPU},
+	CommandInfo{"LMMC",  0xB, true,  Kind::FROM_CPU},
+	CommandInfo{"HMMV",  0xC, false, Kind::BLOCK},
+	CommandInfo{"HMMM",  0xD, false, Kind::BLOCK},
+	CommandInfo{"YMMM",  0xE, false, Kind::BLOCK},
+	CommandInfo{"HMMC",  0xF, false, Kind::FROM_CPU},
+};
+
+struct LogOpInfo {
+	std::string_view name;
+	uint8_t op; // lower nibble of the CMD register
+};
+
+static constexpr auto logOps = std::array{
+	LogOpInfo{"IMP",  0x0}, LogOpInfo{"AND",  0x1}, LogOpInfo{"OR",   0x2},
+	LogOpInfo{"EOR",  0x3}, LogOpInfo{"NOT",  0x4}, LogOpInfo{"TIMP", 0x8},
+	LogOpInfo{"TAND", 0x9}, LogOpInfo{"TOR",  0xA}, LogOpInfo{"TEOR", 0xB},
+	LogOpInfo{"TNOT", 0xC},
+};
+
+struct Result {
+	uint64_t pixels = 0;
+	uint64_t ticks = 0;
+};
+
+class Harness
+{
+public:
+	explicit Harness(MSXMotherBoard& motherBoard)
+		: scheduler(motherBoard.getScheduler())
+		, vdp(checked_cast<VDP&>(*motherBoard.findDevice("VDP")))
+		, engine(vdp.getCmdEngine())
+		, time(motherBoard.getCurrentTime())
+	{
+		// the emulated duration of each command is taken from the profiler
+		engine.getProfileSetting().setBoolean(true);
+
+		auto& vram = vdp.getVRAM();
+		for (auto addr : xrange(vram.getSize())) {
+			vram.cpuWrite(addr, uint8_t(addr * 7), time);
+		}
+	}
+
+	void setMode(const ModeInfo& mode, bool hs, bool evr)
+	{
+		write(0, mode.r0);
+		write(1, 0x40);  // display enabled, M1 = M2 = 0
+		write(8, 0x0A);  // VR, sprites disabled
+		write(9, 0x80);  // 212 lines
+		write(20, (hs ? 0x01 : 0x00) | (evr ? 0x40 : 0x00));
+		write(25, mode.r25);
+		// mode changes take effect at the next line
+		advance(VDP::VDPClock::duration(2 * VDP::TICKS_PER_LINE));
+	}
+
+	/** Copy the left half of lines [0, 64) to the right half of lines
+	  * [256, 320), or the equivalent for the other commands.
+	  */
+	Result run(const CommandInfo& cmd, const ModeInfo& mode, uint8_t op)
+	{
+		unsigned nx = mode.pixelsPerLine / 2;
+		unsigned ny = 64;
+		uint8_t cmdByte = uint8_t((cmd.cmd << 4) | op);
+		Result result;
+		switch (cmd.kind) {
+		case Kind::POINT:
+		case Kind::PSET:
+			for (auto y : xrange(ny)) {
+				for (auto x : xrange(nx)) {
+					if (cmd.kind == Kind::POINT) {
+						setRegs(x, y, 0, 0, 0, 0);
+					} else {
+						setRegs(0, 0, x + nx, y + 256, 0, 0);
+					}
+					result.ticks += execute(cmdByte, cmd.kind);
+				}
+			}
+			result.pixels = nx * ny;
+			break;
+		case Kind::SRCH:
+			for (auto y : xrange(ny)) {
+				setRegs(0, y, 0, 0, 0, 0);
+				result.ticks += execute(cmdByte, cmd.kind);
+				// up to and including the found pixel, or up to the border
+				result.pixels += std::min(engine.getBorderX(time) + 1, mode.pixelsPerLine);
+			}
+			break;
+		case Kind::LINE:
+			for (auto y : xrange(ny)) {
+				setRegs(0, 0, 0, y + 256, nx - 1, y);
+				result.ticks += execute(cmdByte, cmd.kind);
+			}
+			result.pixels = nx * ny;
+			break;
+		case Kind::BLOCK:
+		case Kind::TO_CPU:
+		case Kind::FROM_CPU:
+			// YMMM moves from DX to the right border, that's also 'nx'
+			setRegs(0, 0, nx, 256, nx, ny);
+			result.ticks += execute(cmdByte, cmd.kind);
+			result.pixels = nx * ny;
+			break;
+		}
+		return result;
+	}
+
+private:
+	void advance(EmuDuration d)
+	{
+		time += d;
+		scheduler.schedule(time);
+	}
+
+	void write(uint8_t reg, unsigned value)
+	{
+		vdp.changeRegister(reg, uint8_t(value), time);
+	}
+
+	void setRegs(unsigned sx, unsigned sy, unsigned dx, unsigned dy,
+	             unsigned nx, unsigned ny)
+	{
+		std::array<std::pair<uint8_t, unsigned>, 6> regs = {{
+			{32, sx}, {34, sy}, {36, dx}, {38, dy}, {40, nx}, {42, ny}
+		}};
+		for (auto [reg, value] : regs) {
+			write(reg + 0, value & 0xFF);
+			write(reg + 1, value >> 8);
+		}
+		write(44, color);
+		write(45, 0); // ARG
+	}
+
+	/** Start the command and wait till it's done (polling S#2). Returns
+	  * the number of VDP ticks the command took.
+	  */
+	uint64_t execute(uint8_t cmdByte, Kind kind)
+	{
+		// A CPU polling loop, or an OTIR loop for the transfer commands.
+		static constexpr auto POLL = VDP::VDPClock::duration(6 * 23 * VDP::CLK_MUL);
+		write(46, cmdByte);
+		while (true) {
+			auto status = engine.peekStatus2(time);
+			if (!(status & VDPCmdEngine::CE)) break;
+			if (status & VDPCmdEngine::TR) {
+				if (kind == Kind::TO_CPU) {
+					(void)engine.readColor(time);
+					engine.resetColor();
+				} else if (kind == Kind::FROM_CPU) {
+					color = uint8_t(color * 5 + 1);
+					write(44, color);
+				}
+			}
+			advance(POLL);
+		}
+		const auto& r = engine.getProfiler().back();
+		return VDP::VDPClock(r.start).getTicksTill(r.finish);
+	}
+
+private:
+	Scheduler& scheduler;
+	VDP& vdp;
+	VDPCmdEngine& engine;
+	EmuTime time;
+	uint8_t color = 0x5A;
+};
+
+static int benchmark(unsigned repetitions)
+{
+	Thread::setMainThread();
+	Reactor reactor;
+	reactor.init();
+	auto& settingsConfig = reactor.getGlobalCommandController().getSettingsConfig();
+	settingsConfig.setValueForSetting("sound_driver", "null");
+	try {
+		reactor.switchMachine("VDPCmdEngine_bench");
+	} catch (MSXException& e) {
+		std::cerr << e.getMessage() << "\nIs OPENMSX_USER_DATA set to "
+		             "the directory that contains this benchmark?\n";
+		return 1;
+	}
+	auto& motherBoard = *reactor.getMotherBoard();
+	motherBoard.powerUp();
+	motherBoard.getRealTime().disable(); // run as fast as possible
+
+	Harness harness(motherBoard);
+	std::cout << "command mode logop   hs evr    ns/pixel        ticks\n";
+	for (const auto& cmd : commands) {
+		for (const auto& mode : modes) {
+			auto numOps = cmd.logical ? logOps.size() : 1;
+			for (const auto& logOp : std::span{logOps}.first(numOps)) {
+				for (bool hs : {false, true}) {
+					for (bool evr : {false, true}) {
+						harness.setMode(mode, hs, evr);
+						Result r;
+						auto start = std::chrono::steady_clock::now();
+						for ([[maybe_unused]] auto rep : xrange(repetitions)) {
+							r = harness.run(cmd, mode, logOp.op);
+						}
+						auto stop = std::chrono::steady_clock::now();
+						auto ns = std::chrono::duration<double, std::nano>(stop - start).count();
+						std::cout << std::left
+						          << std::setw(8) << cmd.name
+						          << std::setw(5) << mode.name
+						          << std::setw(8) << logOp.name
+						          << std::setw(3) << hs
+						          << std::setw(4) << evr
+						          << std::right << std::fixed << std::setprecision(3)
+						          << std::setw(9) << ns / double(r.pixels * repetitions)
+						          << std::setw(13) << r.ticks << '\n';
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+} // namespace openmsx
+
+int main(int argc, char** argv)
+{
+	unsigned repetitions = (argc > 1) ? unsigned(std::atoi(argv[1])) : 10;
+	return openmsx::benchmark(repetitions ? repetitions : 1);
+}
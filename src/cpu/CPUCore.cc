@@ -160,12 +160,14 @@
 
 #include "CPUCore.hh"
 
+#include "CPUTrace.hh"
 #include "Dasm.hh"
 #include "MSXCPUInterface.hh"
 #include "R800.hh"
 #include "Z80.hh"
 
 #include "MSXCliComm.hh"
+#include "MSXMemoryMapperBase.hh"
 #include "MSXMotherBoard.hh"
 #include "Scheduler.hh"
 #include "TclCallback.hh"
@@ -293,13 +295,14 @@ struct CondTrue { bool operator()(uint8_t /*f*/) const { return true; } };
 
 template<typename T> CPUCore<T>::CPUCore(
 		MSXMotherBoard& motherboard_, const std::string& name,
-		const BooleanSetting& traceSetting_,
+		const BooleanSetting& traceSetting_, CPUTraceWriter& traceWriter_,
 		TclCallback& diHaltCallback_, EmuTime time)
 	: CPURegs(T::IS_R800)
 	, T(time, motherboard_.getScheduler())
 	, motherboard(motherboard_)
 	, scheduler(motherboard.getScheduler())
 	, traceSetting(traceSetting_)
+	, traceWriter(traceWriter_)
 	, diHaltCallback(diHaltCallback_)
 	, IRQStatus(motherboard.getDebugger(), name + ".pendingIRQ",
 	            "Non-zero if there are pending IRQs (thus CPU would enter "
@@ -2444,6 +2447,25 @@ template<typename T> inline void CPUCore<T>::cpuTracePost()
 template<typename T> void CPUCore<T>::cpuTracePost_slow()
 {
 	std::array<uint8_t, 4> opBuf;
+	if (traceWriter.isOpen()) {
+		auto time = T::getTimeFast();
+		CPUTraceWriter::Slots slots;
+		CPUTraceWriter::Segments segments;
+		for (auto page : xrange(4)) {
+			slots[page] = uint8_t(interface->getPrimarySlot(page) +
+			                      4 * interface->getSecondarySlot(page));
+			const auto* mapper = dynamic_cast<const MSXMemoryMapperBase*>(
+				interface->getVisibleMSXDevice(page));
+			segments[page] = mapper ? mapper->getSelectedSegment(uint8_t(page))
+			                        : CPUTraceWriter::NO_SEGMENT;
+		}
+		traceWriter.record(time, start_pc,
+		                   fetchInstruction(*interface, start_pc, opBuf, time),
+		                   {getAF(), getBC(), getDE(), getHL(),
+		                    getIX(), getIY(), getSP()},
+		                   slots, segments, T::IS_R800);
+		return;
+	}
 	std::string dasmOutput;
 	dasm(*interface, start_pc, opBuf, dasmOutput, T::getTimeFast());
 	dasmOutput.resize(19, ' '); // alternative: print fixed-size field
@@ -18,6 +18,7 @@
 
 namespace openmsx {
 
+class CPUTraceWriter;
 class MSXCPUInterface;
 class Scheduler;
 class MSXMotherBoard;
@@ -56,7 +57,7 @@ class CPUCore final : public CPUBase, public CPURegs, public CPU_POLICY
 {
 public:
 	CPUCore(MSXMotherBoard& motherboard, const std::string& name,
-	        const BooleanSetting& traceSetting,
+	        const BooleanSetting& traceSetting, CPUTraceWriter& traceWriter,
 	        TclCallback& diHaltCallback, EmuTime time);
 
 	void setInterface(MSXCPUInterface* interface_) { interface = interface_; }
@@ -144,6 +145,7 @@ private:
 	MSXCPUInterface* interface = nullptr;
 
 	const BooleanSetting& traceSetting;
+	CPUTraceWriter& traceWriter;
 	TclCallback& diHaltCallback;
 
 	Probe<int> IRQStatus;
@@ -0,0 +1,110 @@
+#include "CPUProfile.hh"
+
+#include "SymbolManager.hh"
+
+#include "strCat.hh"
+
+#include <algorithm>
+#include <tuple>
+
+namespace openmsx {
+
+void CPUProfile::clear()
+{
+	histogram.clear();
+	numSamples = 0;
+}
+
+CPUProfile::Location CPUProfile::unpack(uint64_t key)
+{
+	Location loc;
+	loc.pc = uint16_t(key);
+	loc.ps = uint8_t((key >> 16) & 3);
+	if (key & (uint64_t(1) << 20)) loc.ss = uint8_t((key >> 18) & 3);
+	if (key & (uint64_t(1) << 21)) loc.segment = uint16_t(key >> 32);
+	return loc;
+}
+
+std::vector<CPUProfile::Function> CPUProfile::aggregate(
+	std::span<const SymbolFile> symbolFiles) const
+{
+	std::vector<const Symbol*> symbols;
+	for (const auto& file : symbolFiles) {
+		for (const auto& sym : file.symbols) symbols.push_back(&sym);
+	}
+	std::ranges::stable_sort(symbols, {}, &Symbol::value);
+
+	// Same matching rules as in the disassembly view: skip symbols with a
+	// mismatching slot or segment, prefer the ones that specify both.
+	auto findSymbol = [&](const Location& loc) -> const Symbol* {
+		auto slot = uint8_t(loc.ps + 4 * loc.ss.value_or(0));
+		const Symbol* best = nullptr;
+		int bestPriority = -1;
+		auto it = std::ranges::upper_bound(symbols, loc.pc, {}, &Symbol::value);
+		while (it != symbols.begin()) {
+			const Symbol* sym = *--it;
+			if ((sym->value >> 14) != (loc.pc >> 14)) break; // other page
+			if (best && (sym->value != best->value)) break; // only the nearest
+			if (sym->slot && (*sym->slot != slot)) continue;
+			if (sym->segment && (sym->segment != loc.segment)) continue;
+			int priority = int(sym->slot.has_value()) + int(sym->segment.has_value());
+			if (priority > bestPriority) {
+				best = sym;
+				bestPriority = priority;
+			}
+		}
+		return best;
+	};
+
+	std::vector<Function> result;
+	hash_map<std::string, size_t> index; // "slot;segment;name" -> index in 'result'
+	for (const auto& [key, count] : histogram) {
+		auto loc = unpack(key);
+		Function f;
+		f.slot = loc.ss ? strCat(loc.ps, '-', *loc.ss) : strCat(loc.ps);
+		f.segment = loc.segment ? strCat(*loc.segment) : std::string("-");
+		const auto* sym = findSymbol(loc);
+		f.name = sym ? sym->name : strCat("0x", hex_string<4>(loc.pc));
+		f.count = 0;
+		auto [it, inserted] = index.try_emplace(
+			strCat(f.slot, ';', f.segment, ';', f.name), result.size());
+		if (inserted) result.push_back(std::move(f));
+		result[it->second].count += count;
+	}
+	std::ranges::sort(result, [](const Function& x, const Function& y) {
+		return std::tie(y.count, x.name, x.slot, x.segment) <
+		       std::tie(x.count, y.name, y.slot, y.segment);
+	});
+	return result;
+}
+
+std::string CPUProfile::formatFlat(
+	std::span<const SymbolFile> symbolFiles, size_t maxLines) const
+{
+	auto functions = aggregate(symbolFiles);
+	if (maxLines && (functions.size() > maxLines)) functions.resize(maxLines);
+
+	std::string result = strCat("total samples: ", numSamples, '\n',
+	                            "  samples      %  slot  segment  function\n");
+	for (const auto& f : functions) {
+		auto permille = (f.count * 1000 + numSamples / 2) / numSamples;
+		strAppend(result, dec_string<9>(f.count),
+		          "  ", dec_string<3>(permille / 10), '.', char('0' + permille % 10),
+		          "  ", f.slot, spaces(6 - f.slot.size()),
+		          f.segment, spaces(9 - f.segment.size()),
+		          f.name, '\n');
+	}
+	return result;
+}
+
+std::string CPUProfile::formatCollapsed(std::span<const SymbolFile> symbolFiles) const
+{
+	std::string result;
+	for (const auto& f : aggregate(symbolFiles)) {
+		strAppend(result, "slot ", f.slot, ";segment ", f.segment, ';',
+		          f.name, ' ', f.count, '\n');
+	}
+	return result;
+}
+
+} // namespace openmsx
@@ -0,0 +1,83 @@
+#ifndef CPUPROFILE_HH
+#define CPUPROFILE_HH
+
+#include "hash_map.hh"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace openmsx {
+
+struct SymbolFile;
+
+/** Histogram of sampled CPU locations, filled by the 'cpu_profile' command.
+  *
+  * A location is the PC together with the slot and the mapper (or MegaROM)
+  * segment that was selected in the 16kB page containing that PC. Samples
+  * are only resolved to symbols when a report is generated: a PC is
+  * attributed to the nearest symbol at or below it in the same page, for
+  * which the slot and segment (when specified in the symbol file) match.
+  */
+class CPUProfile
+{
+public:
+	struct Location {
+		uint16_t pc = 0;
+		uint8_t ps = 0;
+		std::optional<uint8_t> ss;       // only for expanded slots
+		std::optional<uint16_t> segment; // only for mappers and MegaROMs
+	};
+
+	void add(const Location& loc)
+	{
+		++histogram[pack(loc)];
+		++numSamples;
+	}
+	void clear();
+
+	[[nodiscard]] uint64_t getNumSamples() const { return numSamples; }
+
+	/** Samples aggregated per function, sorted from most to least
+	  * frequent. One line per function, prefixed with a header.
+	  * @param maxLines Maximum number of functions to show (0 = all).
+	  */
+	[[nodiscard]] std::string formatFlat(
+		std::span<const SymbolFile> symbolFiles, size_t maxLines) const;
+
+	/** Samples aggregated per function in the 'collapsed stack' format
+	  * used by flame graph tools: one "slot;segment;function count" line
+	  * per function.
+	  */
+	[[nodiscard]] std::string formatCollapsed(
+		std::span<const SymbolFile> symbolFiles) const;
+
+private:
+	struct Function {
+		std::string slot;
+		std::string segment;
+		std::string name;
+		uint64_t count;
+	};
+	[[nodiscard]] std::vector<Function> aggregate(
+		std::span<const SymbolFile> symbolFiles) const;
+
+	[[nodiscard]] static uint64_t pack(const Location& loc)
+	{
+		return uint64_t(loc.pc)
+		     | (uint64_t(loc.ps) << 16)
+		     | (loc.ss ? ((uint64_t(*loc.ss) << 18) | (uint64_t(1) << 20)) : 0)
+		     | (loc.segment ? ((uint64_t(*loc.segment) << 32) | (uint64_t(1) << 21)) : 0);
+	}
+	[[nodiscard]] static Location unpack(uint64_t key);
+
+private:
+	hash_map<uint64_t, uint64_t> histogram; // packed Location -> count
+	uint64_t numSamples = 0;
+};
+
+} // namespace openmsx
+
+#endif
@@ -0,0 +1,290 @@
+#include "CPUTrace.hh"
+
+#include "Dasm.hh"
+#include "FileException.hh"
+#include "MSXException.hh"
+
+#include "endian.hh"
+#include "lz4.hh"
+#include "ranges.hh"
+#include "strCat.hh"
+#include "xrange.hh"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <ostream>
+
+namespace openmsx {
+
+// Limit the number of blocks waiting to be written. When the disk can't keep
+// up, emulation is slowed down instead of using more and more memory.
+static constexpr size_t MAX_QUEUED_BLOCKS = 16;
+
+// Maximum size of a single record.
+static constexpr size_t MAX_RECORD_SIZE = 2 + 10 + 2 + 4 + 4 + 1 + 4 + 2 * CPUTraceWriter::NUM_REGS;
+
+CPUTraceWriter::~CPUTraceWriter()
+{
+	close();
+}
+
+void CPUTraceWriter::open(const std::string& filename_)
+{
+	close();
+	file = File(filename_, File::OpenMode::TRUNCATE);
+	file.write(std::span{std::bit_cast<const uint8_t*>(MAGIC.data()), MAGIC.size()});
+	filename = filename_;
+	stop = false;
+	writeError = false;
+	startBlock();
+	thread = std::thread([this] { writerMain(); });
+}
+
+bool CPUTraceWriter::close()
+{
+	if (!isOpen()) return true;
+	flushBlock();
+	{
+		std::scoped_lock lock(mutex);
+		stop = true;
+	}
+	cond.notify_all();
+	thread.join();
+	file.close();
+	filename.clear();
+	return !writeError;
+}
+
+void CPUTraceWriter::startBlock()
+{
+	block.resize(BLOCK_SIZE + MAX_RECORD_SIZE);
+	blockSize = 0;
+	blockStart = true;
+	prevTime = 0;
+}
+
+void CPUTraceWriter::record(
+	EmuTime time, uint16_t pc, std::span<const uint8_t> opcode,
+	const Regs& regs, const Slots& slots, const Segments& segments, bool r800)
+{
+	assert(isOpen());
+	assert(1 <= opcode.size() && opcode.size() <= 4);
+
+	uint8_t regMask = 0;
+	for (auto r : xrange(NUM_REGS)) {
+		if (blockStart || (regs[r] != prevRegs[r])) regMask |= 1 << r;
+	}
+	bool newSlots = blockStart || (slots != prevSlots);
+	bool newSegments = blockStart || (segments != prevSegments);
+
+	uint8_t* p = &block[blockSize];
+	*p++ = uint8_t((opcode.size() - 1) | (newSlots ? 4 : 0) | (r800 ? 8 : 0) |
+	               (newSegments ? 16 : 0));
+	*p++ = regMask;
+
+	uint64_t t = (time - EmuTime::zero()).length();
+	uint64_t delta = t - prevTime;
+	prevTime = t;
+	while (delta >= 0x80) {
+		*p++ = uint8_t(delta | 0x80);
+		delta >>= 7;
+	}
+	*p++ = uint8_t(delta);
+
+	Endian::write_UA_L16(p, pc); p += 2;
+	for (auto b : opcode) *p++ = b;
+	if (newSlots) {
+		for (auto s : slots) *p++ = s;
+		prevSlots = slots;
+	}
+	if (newSegments) {
+		uint8_t& segMask = *p++;
+		segMask = 0;
+		for (auto page : xrange(4)) {
+			if (segments[page] == NO_SEGMENT) continue;
+			segMask |= 1 << page;
+			*p++ = uint8_t(segments[page]);
+		}
+		prevSegments = segments;
+	}
+	for (auto r : xrange(NUM_REGS)) {
+		if (regMask & (1 << r)) {
+			Endian::write_UA_L16(p, regs[r]); p += 2;
+		}
+	}
+	prevRegs = regs;
+	blockStart = false;
+	blockSize = p - block.data();
+
+	if (blockSize >= BLOCK_SIZE) {
+		flushBlock();
+	}
+}
+
+void CPUTraceWriter::flushBlock()
+{
+	if (blockSize == 0) return;
+	block.resize(blockSize);
+	{
+		std::unique_lock lock(mutex);
+		cond.wait(lock, [&] { return queue.size() < MAX_QUEUED_BLOCKS; });
+		queue.push_back(std::move(block));
+	}
+	cond.notify_all();
+	block = {};
+	startBlock();
+}
+
+void CPUTraceWriter::writerMain()
+{
+	std::vector<uint8_t> compressed;
+	std::unique_lock lock(mutex);
+	while (true) {
+		cond.wait(lock, [&] { return stop || !queue.empty(); });
+		if (queue.empty()) return; // stop requested and all blocks written
+		auto raw = std::move(queue.front());
+		queue.pop_front();
+		lock.unlock();
+		cond.notify_all(); // there's room in the queue again
+
+		auto rawSize = int(raw.size());
+		compressed.resize(8 + LZ4::compressBound(rawSize));
+		auto size = LZ4::compress(raw.data(), &compressed[8], rawSize);
+		Endian::write_UA_L32(&compressed[0], uint32_t(rawSize));
+		Endian::write_UA_L32(&compressed[4], uint32_t(size));
+		bool error = false;
+		try {
+			if (!writeError) file.write(subspan(compressed, 0, 8 + size));
+		} catch (FileException&) {
+			error = true;
+		}
+
+		lock.lock();
+		if (error) writeError = true;
+	}
+}
+
+
+void decodeCPUTrace(File& in, std::ostream& out, bool showTime, bool showSlots)
+{
+	auto fileSize = in.getSize();
+	std::array<uint8_t, 8> magic;
+	if (fileSize < magic.size()) throw MSXException("Not a CPU trace file");
+	in.read(magic);
+	if (!std::ranges::equal(magic, CPUTraceWriter::MAGIC,
+	                        [](uint8_t m, char c) { return m == uint8_t(c); })) {
+		throw MSXException("Not a CPU trace file");
+	}
+
+	std::vector<uint8_t> compressed;
+	std::vector<uint8_t> raw;
+	CPUTraceWriter::Regs regs = {};
+	CPUTraceWriter::Slots slots = {};
+	CPUTraceWriter::Segments segments = {};
+	std::string dasmOutput;
+	std::string line;
+	size_t pos = magic.size();
+	while (pos < fileSize) {
+		std::array<uint8_t, 8> header;
+		if ((fileSize - pos) < header.size()) throw MSXException("Truncated CPU trace file");
+		in.read(header);
+		auto rawSize = Endian::read_UA_L32(&header[0]);
+		auto compSize = Endian::read_UA_L32(&header[4]);
+		pos += header.size();
+		// The writer never produces bigger blocks. Checked before
+		// allocating, the file may be damaged.
+		if ((rawSize > CPUTraceWriter::BLOCK_SIZE + MAX_RECORD_SIZE) ||
+		    (compSize > unsigned(LZ4::compressBound(int(rawSize)))) ||
+		    ((fileSize - pos) < compSize)) {
+			throw MSXException("Invalid CPU trace file");
+		}
+		compressed.resize(compSize);
+		in.read(compressed);
+		pos += compSize;
+		raw.resize(rawSize);
+		if (LZ4::decompressSafe(compressed.data(), raw.data(), int(compSize), int(rawSize)) != int(rawSize)) {
+			throw MSXException("Invalid CPU trace file");
+		}
+
+		const uint8_t* p = raw.data();
+		const uint8_t* end = p + raw.size();
+		auto need = [&](size_t n) {
+			if (size_t(end - p) < n) throw MSXException("Invalid CPU trace file");
+		};
+		uint64_t time = 0;
+		while (p != end) {
+			need(2);
+			uint8_t flags = *p++;
+			uint8_t regMask = *p++;
+
+			uint64_t delta = 0;
+			for (int shift = 0; true; shift += 7) {
+				need(1);
+				if (shift > 63) throw MSXException("Invalid CPU trace file");
+				uint8_t b = *p++;
+				delta |= uint64_t(b & 0x7F) << shift;
+				if (!(b & 0x80)) break;
+			}
+			time += delta;
+
+			size_t len = (flags & 3) + 1;
+			need(2 + len);
+			uint16_t pc = Endian::read_UA_L16(p); p += 2;
+			std::span<const uint8_t> opcode{p, len}; p += len;
+			if (flags & 4) {
+				need(slots.size());
+				for (auto& s : slots) s = *p++;
+			}
+			if (flags & 16) {
+				need(1);
+				uint8_t segMask = *p++;
+				for (auto page : xrange(4)) {
+					if (segMask & (1 << page)) {
+						need(1);
+						segments[page] = *p++;
+					} else {
+						segments[page] = CPUTraceWriter::NO_SEGMENT;
+					}
+				}
+			}
+			for (auto r : xrange(CPUTraceWriter::NUM_REGS)) {
+				if (regMask & (1 << r)) {
+					need(2);
+					regs[r] = Endian::read_UA_L16(p); p += 2;
+				}
+			}
+
+			dasmOutput.clear();
+			dasm(opcode, pc, dasmOutput);
+			dasmOutput.resize(19, ' ');
+			line.clear();
+			if (showTime) {
+				strAppend(line, (EmuTime::makeEmuTime(time) - EmuTime::zero()).toDouble(), ' ');
+			}
+			strAppend(line, hex_string<4>(pc),
+			          " : ", dasmOutput,
+			          " AF=", hex_string<4>(regs[CPUTraceWriter::AF]),
+			          " BC=", hex_string<4>(regs[CPUTraceWriter::BC]),
+			          " DE=", hex_string<4>(regs[CPUTraceWriter::DE]),
+			          " HL=", hex_string<4>(regs[CPUTraceWriter::HL]),
+			          " IX=", hex_string<4>(regs[CPUTraceWriter::IX]),
+			          " IY=", hex_string<4>(regs[CPUTraceWriter::IY]),
+			          " SP=", hex_string<4>(regs[CPUTraceWriter::SP]));
+			if (showSlots) {
+				strAppend(line, " slots=");
+				for (auto page : xrange(4)) {
+					if (page) line += ',';
+					strAppend(line, slots[page] & 3, '-', (slots[page] >> 2) & 3);
+					if (segments[page] != CPUTraceWriter::NO_SEGMENT) {
+						strAppend(line, ':', hex_string<2>(segments[page]));
+					}
+				}
+			}
+			line += '\n';
+			out << line;
+		}
+	}
+}
+
+} // namespace openmsx
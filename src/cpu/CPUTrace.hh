@@ -0,0 +1,133 @@
+#ifndef CPUTRACE_HH
+#define CPUTRACE_HH
+
+#include "EmuTime.hh"
+#include "File.hh"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <iosfwd>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace openmsx {
+
+/** Writes a binary CPU instruction trace to a file.
+  *
+  * This is the fast alternative for the textual 'cputrace' output: per
+  * instruction only the PC, the opcode bytes, the registers that changed,
+  * the slot selection and the memory mapper segments (when they changed)
+  * and the time delta are recorded. The segments are only known for pages
+  * that show a memory mapper (MSXMemoryMapperBase), the blocks selected in
+  * a ROM mapper are not recorded.
+  * Records are collected in blocks, each block is LZ4-compressed and
+  * written to disk by a separate thread. Use decodeCPUTrace() to convert
+  * the result back to text.
+  *
+  * File format (all values little endian):
+  *   header: the 8 bytes MAGIC
+  *   blocks: uint32 raw size, uint32 compressed size, compressed data
+  * Each block can be decoded on its own, it contains a sequence of records:
+  *   uint8   bits 1-0: opcode length - 1
+  *           bit 2: slot selection follows
+  *           bit 3: executed by the R800 (otherwise Z80)
+  *           bit 4: memory mapper segments follow
+  *   uint8   bitmask of the registers that follow (bit n = Reg n)
+  *   varint  time since the previous record in this block (for the first
+  *           record: the absolute time), in EmuTime units
+  *   uint16  PC
+  *   1-4     opcode bytes
+  *   4x8bit  (optional) per page: primary slot + 4 * secondary slot
+  *   uint8   (optional) bitmask of the pages that show a memory mapper,
+  *   Nx8bit  followed by the selected segment for each of those pages
+  *   Nx16bit the changed registers
+  */
+class CPUTraceWriter
+{
+public:
+	static constexpr std::array<char, 8> MAGIC = {'O', 'M', 'S', 'X', 'T', 'R', 'C', '1'};
+	static constexpr size_t BLOCK_SIZE = 256 * 1024; // uncompressed
+
+	enum Reg : uint8_t { AF, BC, DE, HL, IX, IY, SP };
+	static constexpr size_t NUM_REGS = SP + 1;
+	using Regs = std::array<uint16_t, NUM_REGS>;
+	using Slots = std::array<uint8_t, 4>;
+	/** Per page the selected memory mapper segment, or NO_SEGMENT. */
+	using Segments = std::array<uint16_t, 4>;
+	static constexpr uint16_t NO_SEGMENT = 0xFFFF;
+
+	CPUTraceWriter() = default;
+	CPUTraceWriter(const CPUTraceWriter&) = delete;
+	CPUTraceWriter(CPUTraceWriter&&) = delete;
+	CPUTraceWriter& operator=(const CPUTraceWriter&) = delete;
+	CPUTraceWriter& operator=(CPUTraceWriter&&) = delete;
+	~CPUTraceWriter();
+
+	/** Start a new trace, an already open trace is closed first.
+	  * @throws FileException when the file can't be created.
+	  */
+	void open(const std::string& filename);
+
+	/** Write all pending records and close the file.
+	  * @return False iff (some of) the data couldn't be written.
+	  */
+	bool close();
+
+	[[nodiscard]] bool isOpen() const { return thread.joinable(); }
+	[[nodiscard]] const std::string& getFilename() const { return filename; }
+
+	/** Add one executed instruction to the trace. Only allowed while open.
+	  * @param time The moment the instruction finished.
+	  * @param pc The address of the instruction.
+	  * @param opcode The instruction bytes, 1 up to 4.
+	  * @param regs The register values after the instruction.
+	  * @param slots Per page the selected slot (primary + 4 * secondary).
+	  * @param segments Per page the selected memory mapper segment.
+	  * @param r800 Executed by the R800 (true) or by the Z80 (false).
+	  */
+	void record(EmuTime time, uint16_t pc, std::span<const uint8_t> opcode,
+	            const Regs& regs, const Slots& slots,
+	            const Segments& segments, bool r800);
+
+private:
+	void startBlock();
+	void flushBlock();
+	void writerMain();
+
+private:
+	// Only accessed from the emulation thread.
+	std::vector<uint8_t> block;
+	size_t blockSize = 0; // used part of 'block'
+	uint64_t prevTime = 0;
+	Regs prevRegs = {};
+	Slots prevSlots = {};
+	Segments prevSegments = {};
+	bool blockStart = true;
+	std::string filename;
+
+	// Shared with the writer thread.
+	File file; // only used by the writer thread while it runs
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::deque<std::vector<uint8_t>> queue;
+	bool stop = false;
+	bool writeError = false;
+};
+
+/** Convert a binary trace (see CPUTraceWriter) to text. The output has the
+  * same format as the textual 'cputrace' output, optionally extended with
+  * the time (in seconds) and the slot selection (including the memory
+  * mapper segments).
+  * @throws MSXException on read errors or an invalid trace file.
+  */
+void decodeCPUTrace(File& in, std::ostream& out, bool showTime, bool showSlots);
+
+} // namespace openmsx
+
+#endif
@@ -5,10 +5,22 @@
 #include "R800.hh"
 #include "Z80.hh"
 
+#include "CommandException.hh"
 #include "Debugger.hh"
+#include "File.hh"
+#include "FileContext.hh"
+#include "FileOperations.hh"
 #include "IntegerSetting.hh"
+#include "MSXCliComm.hh"
+#include "MSXMemoryMapperBase.hh"
 #include "MSXMotherBoard.hh"
+#include "MSXRom.hh"
+#include "Reactor.hh"
+#include "RomBlockDebuggable.hh"
+#include "RomPlain.hh"
 #include "Scheduler.hh"
+#include "SymbolManager.hh"
+#include "TclArgParser.hh"
 #include "TclObject.hh"
 #include "serialize.hh"
 
@@ -19,6 +31,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <fstream>
 #include <memory>
 
 namespace openmsx {
@@ -28,17 +41,21 @@ MSXCPU::MSXCPU(MSXMotherBoard& motherboard_)
 	, traceSetting(
 		motherboard.getCommandController(), "cputrace",
 		"CPU tracing on/off", false, Setting::Save::NO)
+	, traceFileSetting(
+		motherboard.getCommandController(), "cputrace_file",
+		"when set, cputrace writes a compressed binary trace to this file "
+		"instead of printing text (convert with 'cputrace_decode')", "")
 	, diHaltCallback(
 		motherboard.getCommandController(), "di_halt_callback",
 		"Tcl proc called when the CPU executed a DI/HALT sequence",
 		"default_di_halt_callback",
 		Setting::Save::YES) // user must be able to override
 	, z80(std::make_unique<CPUCore<Z80TYPE>>(
-		motherboard, "z80", traceSetting,
+		motherboard, "z80", traceSetting, traceWriter,
 		diHaltCallback, EmuTime::zero()))
 	, r800(motherboard.isTurboR()
 		? std::make_unique<CPUCore<R800TYPE>>(
-			motherboard, "r800", traceSetting,
+			motherboard, "r800", traceSetting, traceWriter,
 			diHaltCallback, EmuTime::zero())
 		: nullptr)
 	, timeInfo(motherboard.getMachineInfoCommand())
@@ -47,11 +64,15 @@ MSXCPU::MSXCPU(MSXMotherBoard& motherboard_)
 		? std::make_unique<CPUFreqInfoTopic>(
 			motherboard.getMachineInfoCommand(), "r800_freq", *r800)
 		: nullptr)
+	, traceDecodeCmd(motherboard.getCommandController())
+	, profileSampler(motherboard.getScheduler())
+	, profileCmd(motherboard.getCommandController())
 	, debuggable(motherboard_)
 {
 	motherboard.getDebugger().setCPU(this);
 	motherboard.getScheduler().setCPU(this);
 	traceSetting.attach(*this);
+	traceFileSetting.attach(*this);
 
 	z80->freqLocked.attach(*this);
 	z80->freqValue.attach(*this);
@@ -64,6 +85,7 @@ MSXCPU::MSXCPU(MSXMotherBoard& motherboard_)
 
 MSXCPU::~MSXCPU()
 {
+	traceFileSetting.detach(*this);
 	traceSetting.detach(*this);
 	z80->freqLocked.detach(*this);
 	z80->freqValue.detach(*this);
@@ -350,11 +372,35 @@ CPURegs& MSXCPU::getRegisters()
 
 void MSXCPU::update(const Setting& setting) noexcept
 {
+	if ((&setting == &traceSetting) || (&setting == &traceFileSetting)) {
+		updateTraceWriter();
+	}
 	          z80 ->update(setting);
 	if (r800) r800->update(setting);
 	exitCPULoopSync();
 }
 
+void MSXCPU::updateTraceWriter() noexcept
+{
+	auto& cliComm = motherboard.getMSXCliComm();
+	std::string filename;
+	if (traceSetting.getBoolean() && !traceFileSetting.getString().empty()) {
+		filename = userFileContext().resolve(traceFileSetting.getString());
+	}
+	if (traceWriter.isOpen() && (traceWriter.getFilename() != filename)) {
+		if (!traceWriter.close()) {
+			cliComm.printWarning("Error while writing the CPU trace file.");
+		}
+	}
+	if (!filename.empty() && !traceWriter.isOpen()) {
+		try {
+			traceWriter.open(filename);
+		} catch (MSXException& e) {
+			cliComm.printWarning("Couldn't create CPU trace file: ", e.getMessage());
+		}
+	}
+}
+
 void MSXCPU::setPaused(bool paused)
 {
 	if (z80Active) {
@@ -367,6 +413,66 @@ void MSXCPU::setPaused(bool paused)
 }
 
 
+void MSXCPU::takeProfileSample()
+{
+	CPUProfile::Location loc;
+	loc.pc = getRegisters().getPC();
+	int page = loc.pc >> 14;
+	loc.ps = interface->getPrimarySlot(page);
+	if (interface->isExpanded(loc.ps)) {
+		loc.ss = interface->getSecondarySlot(page);
+	}
+	const auto* device = interface->getVisibleMSXDevice(page);
+	if (const auto* mapper = dynamic_cast<const MSXMemoryMapperBase*>(device)) {
+		loc.segment = mapper->getSelectedSegment(narrow<uint8_t>(page));
+	} else if (const auto* rom = dynamic_cast<const MSXRom*>(device);
+	           rom && !dynamic_cast<const RomPlain*>(rom)) {
+		if (auto* romBlocks = dynamic_cast<RomBlockDebuggableBase*>(
+			motherboard.getDebugger().findDebuggable(rom->getName() + " romblocks"))) {
+			if (auto seg = romBlocks->readExt(loc.pc); seg <= 0xFFFF) {
+				loc.segment = narrow_cast<uint16_t>(seg);
+			}
+		}
+	}
+	profile.add(loc);
+}
+
+
+// class ProfileSampler
+
+MSXCPU::ProfileSampler::ProfileSampler(Scheduler& scheduler_)
+	: Schedulable(scheduler_)
+{
+}
+
+void MSXCPU::ProfileSampler::start(EmuTime time, unsigned interval_)
+{
+	interval = interval_;
+	removeSyncPoints();
+	setSyncPoint(time + getStep());
+}
+
+void MSXCPU::ProfileSampler::stop()
+{
+	removeSyncPoints();
+}
+
+EmuDuration MSXCPU::ProfileSampler::getStep() const
+{
+	const auto& cpu = OUTER(MSXCPU, profileSampler);
+	unsigned freq = cpu.z80Active ? cpu.z80->getFreq() : cpu.r800->getFreq();
+	return EmuDuration::hz(freq) * interval;
+}
+
+void MSXCPU::ProfileSampler::executeUntil(EmuTime time)
+{
+	// Sync points are handled in between instructions (or during an I/O
+	// access), so the PC points to the instruction that's being executed.
+	OUTER(MSXCPU, profileSampler).takeProfileSample();
+	setSyncPoint(time + getStep());
+}
+
+
 // class TimeInfoTopic
 
 MSXCPU::TimeInfoTopic::TimeInfoTopic(InfoCommand& machineInfoCommand)
@@ -414,6 +520,159 @@ std::string MSXCPU::CPUFreqInfoTopic::help(std::span<const TclObject> /*tokens*/
 }
 
 
+// class TraceDecodeCmd
+
+MSXCPU::TraceDecodeCmd::TraceDecodeCmd(CommandController& commandController_)
+	: Command(commandController_, "cputrace_decode")
+{
+}
+
+void MSXCPU::TraceDecodeCmd::execute(std::span<const TclObject> tokens, TclObject& /*result*/)
+{
+	bool showTime = false;
+	bool showSlots = false;
+	std::array info = {
+		flagArg("-time", showTime),
+		flagArg("-slots", showSlots),
+	};
+	auto arguments = parseTclArgs(getInterpreter(), tokens.subspan(1), info);
+	if (arguments.size() != 2) throw SyntaxError();
+
+	auto context = userFileContext();
+	File in(context.resolve(arguments[0].getString()));
+	std::ofstream out;
+	FileOperations::openOfStream(out, context.resolve(arguments[1].getString()));
+	if (!out.is_open()) {
+		throw CommandException("Couldn't create output file: ", arguments[1].getString());
+	}
+	decodeCPUTrace(in, out, showTime, showSlots);
+	if (!out) {
+		throw CommandException("Error while writing output file: ", arguments[1].getString());
+	}
+}
+
+std::string MSXCPU::TraceDecodeCmd::help(std::span<const TclObject> /*tokens*/) const
+{
+	return "cputrace_decode [-time] [-slots] <tracefile> <textfile>\n"
+	       "Converts a binary CPU trace (see the 'cputrace_file' setting) to text,\n"
+	       "in the same format as the regular 'cputrace' output.\n"
+	       "  -time   prefix each instruction with the emulated time (in seconds)\n"
+	       "  -slots  append the selected slot (primary-secondary) for each page,\n"
+	       "          and the segment (':xx') for pages that show a memory mapper\n";
+}
+
+
+// class ProfileCmd
+
+MSXCPU::ProfileCmd::ProfileCmd(CommandController& commandController_)
+	: Command(commandController_, "cpu_profile")
+{
+}
+
+static void writeProfile(const std::string& text, std::span<const TclObject> arguments,
+                         TclObject& result)
+{
+	if (arguments.empty()) {
+		result = text;
+		return;
+	}
+	auto filename = userFileContext().resolve(arguments[0].getString());
+	std::ofstream out;
+	FileOperations::openOfStream(out, filename);
+	if (!out.is_open()) {
+		throw CommandException("Couldn't create output file: ", arguments[0].getString());
+	}
+	out << text;
+	if (!out) {
+		throw CommandException("Error while writing output file: ", arguments[0].getString());
+	}
+}
+
+void MSXCPU::ProfileCmd::execute(std::span<const TclObject> tokens, TclObject& result)
+{
+	checkNumArgs(tokens, AtLeast{2}, "subcommand ?arg ...?");
+	auto& cpu = OUTER(MSXCPU, profileCmd);
+	auto& sampler = cpu.profileSampler;
+	auto symbolFiles = [&]() -> std::span<const SymbolFile> {
+		return cpu.motherboard.getReactor().getSymbolManager().getFiles();
+	};
+	executeSubCommand(tokens[1].getString(),
+		"start", [&]{
+			int interval = 1000;
+			std::array info = {valueArg("-interval", interval)};
+			auto arguments = parseTclArgs(getInterpreter(), tokens.subspan(2), info);
+			if (!arguments.empty()) throw SyntaxError();
+			if (interval <= 0) {
+				throw CommandException("Interval must be a positive number of cycles");
+			}
+			sampler.start(cpu.motherboard.getCurrentTime(), interval);
+		},
+		"stop", [&]{
+			checkNumArgs(tokens, 2, Prefix{2}, nullptr);
+			sampler.stop();
+		},
+		"clear", [&]{
+			checkNumArgs(tokens, 2, Prefix{2}, nullptr);
+			cpu.profile.clear();
+		},
+		"status", [&]{
+			checkNumArgs(tokens, 2, Prefix{2}, nullptr);
+			result.addDictKeyValues("running", sampler.isRunning(),
+			                        "interval", sampler.getInterval(),
+			                        "samples", strCat(cpu.profile.getNumSamples()));
+		},
+		"flat", [&]{
+			int maxLines = 0;
+			std::array info = {valueArg("-max", maxLines)};
+			auto arguments = parseTclArgs(getInterpreter(), tokens.subspan(2), info);
+			if (arguments.size() > 1) throw SyntaxError();
+			if (!cpu.profile.getNumSamples()) {
+				throw CommandException("No samples, use 'cpu_profile start' first");
+			}
+			writeProfile(cpu.profile.formatFlat(symbolFiles(), std::max(maxLines, 0)),
+			             arguments, result);
+		},
+		"collapsed", [&]{
+			checkNumArgs(tokens, Between{2, 3}, Prefix{2}, "?filename?");
+			writeProfile(cpu.profile.formatCollapsed(symbolFiles()),
+			             tokens.subspan(2), result);
+		});
+}
+
+std::string MSXCPU::ProfileCmd::help(std::span<const TclObject> /*tokens*/) const
+{
+	return "Sampling profiler for the emulated CPU (Z80 or R800).\n"
+	       "cpu_profile start [-interval <cycles>]  start taking a sample every <cycles> CPU\n"
+	       "                                        cycles (default 1000)\n"
+	       "cpu_profile stop                        stop sampling, keeps the samples\n"
+	       "cpu_profile clear                       discard all samples\n"
+	       "cpu_profile status                      running state, interval and number of samples\n"
+	       "cpu_profile flat [-max <n>] [<file>]    samples per function, most frequent first\n"
+	       "cpu_profile collapsed [<file>]          samples per function in the collapsed stack\n"
+	       "                                        format used by flame graph tools\n"
+	       "Without filename the report is returned as result. Each sample records the PC,\n"
+	       "the slot and the mapper/ROM segment of that address. Samples are attributed\n"
+	       "to the nearest symbol at or below the PC (in the same page) with a matching\n"
+	       "slot and segment, see 'symbols'.\n";
+}
+
+void MSXCPU::ProfileCmd::tabCompletion(std::vector<std::string>& tokens) const
+{
+	using namespace std::literals;
+	if (tokens.size() == 2) {
+		static constexpr std::array cmds = {
+			"start"sv, "stop"sv, "clear"sv, "status"sv, "flat"sv, "collapsed"sv,
+		};
+		completeString(tokens, cmds);
+	} else if ((tokens.size() >= 3) && (tokens[1] == "start")) {
+		static constexpr std::array options = {"-interval"sv};
+		completeString(tokens, options);
+	} else if ((tokens.size() >= 3) && ((tokens[1] == "flat") || (tokens[1] == "collapsed"))) {
+		completeFileName(tokens, userFileContext());
+	}
+}
+
+
 // class Debuggable
 
 static constexpr static_string_view CPU_REGS_DESC =
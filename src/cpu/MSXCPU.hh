@@ -2,11 +2,16 @@
 #define MSXCPU_HH
 
 #include "CacheLine.hh"
+#include "CPUProfile.hh"
+#include "CPUTrace.hh"
 
 #include "BooleanSetting.hh"
+#include "Command.hh"
 #include "EmuTime.hh"
+#include "FilenameSetting.hh"
 #include "InfoTopic.hh"
 #include "Observer.hh"
+#include "Schedulable.hh"
 #include "SimpleDebuggable.hh"
 #include "TclCallback.hh"
 #include "serialize_meta.hh"
@@ -172,6 +177,12 @@ private:
 	// Observer<Setting>
 	void update(const Setting& setting) noexcept override;
 
+	/** Open or close the binary trace file according to the settings. */
+	void updateTraceWriter() noexcept;
+
+	/** Add the current CPU location to 'profile'. */
+	void takeProfileSample();
+
 	template<bool READ, bool WRITE, bool SUB_START>
 	void setRWCache(unsigned start, unsigned size, const uint8_t* rData, uint8_t* wData, int ps, int ss,
 	                std::span<const uint8_t, 256> disallowRead, std::span<const uint8_t, 256> disallowWrite);
@@ -179,6 +190,8 @@ private:
 private:
 	MSXMotherBoard& motherboard;
 	BooleanSetting traceSetting;
+	FilenameSetting traceFileSetting;
+	CPUTraceWriter traceWriter;
 	TclCallback diHaltCallback;
 	const std::unique_ptr<CPUCore<Z80TYPE>> z80;
 	const std::unique_ptr<CPUCore<R800TYPE>> r800; // can be nullptr
@@ -207,6 +220,32 @@ private:
 	CPUFreqInfoTopic                        z80FreqInfo;  // always present
 	const std::unique_ptr<CPUFreqInfoTopic> r800FreqInfo; // can be nullptr
 
+	struct TraceDecodeCmd final : Command {
+		explicit TraceDecodeCmd(CommandController& commandController);
+		void execute(std::span<const TclObject> tokens, TclObject& result) override;
+		[[nodiscard]] std::string help(std::span<const TclObject> tokens) const override;
+	} traceDecodeCmd;
+
+	struct ProfileSampler final : Schedulable {
+		explicit ProfileSampler(Scheduler& scheduler);
+		void start(EmuTime time, unsigned interval);
+		void stop();
+		[[nodiscard]] bool isRunning() const { return pendingSyncPoint(); }
+		[[nodiscard]] unsigned getInterval() const { return interval; }
+		void executeUntil(EmuTime time) override;
+	private:
+		[[nodiscard]] EmuDuration getStep() const;
+		unsigned interval = 0; // in cycles of the active CPU
+	} profileSampler;
+	CPUProfile profile;
+
+	struct ProfileCmd final : Command {
+		explicit ProfileCmd(CommandController& commandController);
+		void execute(std::span<const TclObject> tokens, TclObject& result) override;
+		[[nodiscard]] std::string help(std::span<const TclObject> tokens) const override;
+		void tabCompletion(std::vector<std::string>& tokens) const override;
+	} profileCmd;
+
 	struct Debuggable final : SimpleDebuggable {
 		explicit Debuggable(MSXMotherBoard& motherboard);
 		[[nodiscard]] uint8_t read(unsigned address) override;
@@ -125,6 +125,7 @@ MSXCPUInterface::MSXCPUInterface(MSXMotherBoard& motherBoard_)
 			IO_Out[port] = delayDevice.get();
 		}
 	}
+	updateIOTable();
 
 	if (breakedSettingCount++ == 0) {
 		assert(!breakedSetting);
@@ -333,6 +334,17 @@ void MSXCPUInterface::changeExpanded(bool newExpanded)
 	msxcpu.invalidateAllSlotsRWCache(0xFFFF & CacheLine::HIGH, 0x100);
 }
 
+void MSXCPUInterface::updateIOTable(uint8_t port)
+{
+	ioReadTable [port] = {IO_In [port]->getReadIOFunc(),  IO_In [port]};
+	ioWriteTable[port] = {IO_Out[port]->getWriteIOFunc(), IO_Out[port]};
+}
+
+void MSXCPUInterface::updateIOTable()
+{
+	for (auto port : xrange(256)) updateIOTable(narrow<uint8_t>(port));
+}
+
 MSXDevice*& MSXCPUInterface::getDevicePtr(uint8_t port, bool isIn)
 {
 	MSXDevice** devicePtr = isIn ? &IO_In[port] : &IO_Out[port];
@@ -350,24 +362,28 @@ void MSXCPUInterface::register_IO_In(uint8_t port, MSXDevice* device)
 {
 	MSXDevice*& devicePtr = getDevicePtr(port, true); // in
 	register_IO(port, true, devicePtr, device); // in
+	updateIOTable(port);
 }
 
 void MSXCPUInterface::unregister_IO_In(uint8_t port, MSXDevice* device)
 {
 	MSXDevice*& devicePtr = getDevicePtr(port, true); // in
 	unregister_IO(devicePtr, device);
+	updateIOTable(port);
 }
 
 void MSXCPUInterface::register_IO_Out(uint8_t port, MSXDevice* device)
 {
 	MSXDevice*& devicePtr = getDevicePtr(port, false); // out
 	register_IO(port, false, devicePtr, device); // out
+	updateIOTable(port);
 }
 
 void MSXCPUInterface::unregister_IO_Out(uint8_t port, MSXDevice* device)
 {
 	MSXDevice*& devicePtr = getDevicePtr(port, false); // out
 	unregister_IO(devicePtr, device);
+	updateIOTable(port);
 }
 
 void MSXCPUInterface::register_IO_InOut(uint8_t port, MSXDevice* device)
@@ -462,6 +478,7 @@ bool MSXCPUInterface::replace_IO_In(
 		return false;
 	}
 	devicePtr = newDevice;
+	updateIOTable(port);
 	return true;
 }
 bool MSXCPUInterface::replace_IO_Out(
@@ -473,6 +490,7 @@ bool MSXCPUInterface::replace_IO_Out(
 		return false;
 	}
 	devicePtr = newDevice;
+	updateIOTable(port);
 	return true;
 }
 
@@ -926,9 +944,11 @@ void MSXCPUInterface::registerWatchPoint(WatchPoint& wp)
 	using enum WatchPoint::Type;
 	case READ_IO:
 		wp.registerIOWatch(motherBoard, IO_In);
+		updateIOTable();
 		break;
 	case WRITE_IO:
 		wp.registerIOWatch(motherBoard, IO_Out);
+		updateIOTable();
 		break;
 	case READ_MEM:
 	case WRITE_MEM:
@@ -946,9 +966,11 @@ void MSXCPUInterface::unregisterWatchPoint(WatchPoint& wp)
 	using enum WatchPoint::Type;
 	case READ_IO:
 		wp.unregisterIOWatch(IO_In);
+		updateIOTable();
 		break;
 	case WRITE_IO:
 		wp.unregisterIOWatch(IO_Out);
+		updateIOTable();
 		break;
 	case READ_MEM:
 	case WRITE_MEM:
@@ -164,7 +164,8 @@ public:
 	 * @see MSXDevice::readIO()
 	 */
 	uint8_t readIO(uint16_t port, EmuTime time) {
-		return IO_In[port & 0xFF]->readIO(port, time);
+		const auto& entry = ioReadTable[port & 0xFF];
+		return entry.func(*entry.device, port, time);
 	}
 
 	/**
@@ -172,7 +173,8 @@ public:
 	 * @see MSXDevice::writeIO()
 	 */
 	void writeIO(uint16_t port, uint8_t value, EmuTime time) {
-		IO_Out[port & 0xFF]->writeIO(port, value, time);
+		const auto& entry = ioWriteTable[port & 0xFF];
+		entry.func(*entry.device, port, value, time);
 	}
 
 	/**
@@ -335,6 +337,8 @@ private:
 	void writeMemSlow(uint16_t address, uint8_t value, EmuTime time);
 
 	MSXDevice*& getDevicePtr(uint8_t port, bool isIn);
+	void updateIOTable(uint8_t port);
+	void updateIOTable();
 
 	void register_IO  (int port, bool isIn,
 	                   MSXDevice*& devicePtr, MSXDevice* device);
@@ -448,6 +452,20 @@ private:
 
 	std::array<MSXDevice*, 256> IO_In;
 	std::array<MSXDevice*, 256> IO_Out;
+
+	// Per port the entry point of the device in IO_In/IO_Out, see
+	// MSXDevice::getReadIOFunc(). Must be updated (updateIOTable())
+	// whenever IO_In/IO_Out changes.
+	struct IOReadEntry {
+		MSXDevice::ReadIOFunc func;
+		MSXDevice* device;
+	};
+	struct IOWriteEntry {
+		MSXDevice::WriteIOFunc func;
+		MSXDevice* device;
+	};
+	std::array<IOReadEntry,  256> ioReadTable;
+	std::array<IOWriteEntry, 256> ioWriteTable;
 	std::array<std::array<std::array<MSXDevice*, 4>, 4>, 4> slotLayout;
 	std::array<MSXDevice*, 4> visibleDevices;
 	std::array<uint8_t, 4> subSlotRegister;
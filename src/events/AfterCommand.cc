@@ -6,6 +6,7 @@
 #include "EmuTime.hh"
 #include "Event.hh"
 #include "EventDistributor.hh"
+#include "HostTimeProfile.hh"
 #include "InputEventFactory.hh"
 #include "MSXMotherBoard.hh"
 #include "ObjectPool.hh"
@@ -459,6 +460,7 @@ AfterCmd::AfterCmd(AfterCommand& afterCommand_, TclObject command_)
 
 void AfterCmd::execute()
 {
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::TCL);
 	try {
 		command.executeCommand(afterCommand.getInterpreter());
 	} catch (CommandException& e) {
@@ -332,6 +332,8 @@ void ImGuiReverseBar::paint(MSXMotherBoard* motherBoard)
 			im::Tooltip([&] {
 				ImGui::TextUnformatted(formatTime(timeOffset));
 			});
+			// likely the next goto target, prepare for it
+			reverseManager.requestPreRoll(b + timeOffset);
 			if (ImGui::IsMouseReleased(ImGuiMouseButton_Left)) {
 				manager.executeDelayed(makeTclList("reverse", "goto", b + timeOffset));
 			}
@@ -1,9 +1,12 @@
 #include "ImGuiVdpRegs.hh"
 
 #include "ImGuiCpp.hh"
+#include "ImGuiManager.hh"
 #include "ImGuiUtils.hh"
 
+#include "Reactor.hh"
 #include "VDP.hh"
+#include "VDPCmdEngine.hh"
 
 #include "strCat.hh"
 #include "xrange.hh"
@@ -12,6 +15,7 @@
 #include "imgui.h"
 #include "imgui_internal.h"
 
+#include <algorithm>
 #include <array>
 #include <bit>
 
@@ -740,6 +744,120 @@ void ImGuiVdpRegs::drawSection(std::span<const uint8_t> showRegisters, std::span
 	}
 }
 
+static constexpr std::array<std::string_view, VDPCmdCache::NUM_COMMANDS> commandNames = {
+	"ABRT", "????", "????", "????", "POINT", "PSET", "SRCH", "LINE",
+	"LMMV", "LMMM", "LMCM", "LMMC", "HMMV", "HMMM", "YMMM", "HMMC",
+};
+static constexpr std::array<std::string_view, 16> logOpNames = {
+	"IMP", "AND", "OR", "XOR", "NOT", "NOP", "NOP", "NOP",
+	"TIMP", "TAND", "TOR", "TXOR", "TNOT", "NOP", "NOP", "NOP",
+};
+static constexpr std::array<zstring_view, VDPCmdCache::NUM_STATS> statNames = {
+	"Read hit", "Read miss", "Read flush",
+	"Write hit", "Write miss", "Write flush",
+};
+
+void ImGuiVdpRegs::drawCacheStats(VDPCmdEngine& cmdEngine)
+{
+
+	const auto& counters = cmdEngine.getCacheCounters();
+	int flags = ImGuiTableFlags_RowBg |
+	            ImGuiTableFlags_BordersV |
+	            ImGuiTableFlags_BordersOuter |
+	            ImGuiTableFlags_SizingFixedFit;
+	im::Table("##cache-stats", 1 + VDPCmdCache::NUM_STATS, flags, [&]{
+		ImGui::TableSetupColumn("Command");
+		for (const auto& name : statNames) {
+			ImGui::TableSetupColumn(name.c_str());
+		}
+		ImGui::TableHeadersRow();
+
+		for (auto cmd : xrange(VDPCmdCache::NUM_COMMANDS)) {
+			const auto& row = counters[cmd];
+			if (std::ranges::all_of(row, [](uint32_t c) { return c == 0; })) continue;
+			if (ImGui::TableNextColumn()) {
+				ImGui::TextUnformatted(commandNames[cmd]);
+			}
+			for (auto c : row) {
+				if (ImGui::TableNextColumn()) {
+					ImGui::StrCat(c);
+				}
+			}
+		}
+	});
+	if (ImGui::Button("Reset")) {
+		cmdEngine.resetCacheCounters();
+	}
+}
+
+void ImGuiVdpRegs::drawCmdTimeline(VDPCmdEngine& cmdEngine, EmuTime time)
+{
+	const auto& hotKey = manager.getReactor().getHotKey();
+	Checkbox(hotKey, "Record commands", cmdEngine.getProfileSetting());
+	ImGui::SameLine();
+	if (ImGui::Button("Clear")) {
+		cmdEngine.clearProfiler();
+	}
+	ImGui::SameLine();
+	ImGui::SetNextItemWidth(10.0f * ImGui::GetFontSize());
+	ImGui::SliderInt("Range (ms)", &timelineRange, 1, 1000, "%d", ImGuiSliderFlags_Logarithmic);
+
+	auto seconds = [](EmuTime t) { return (t - EmuTime::zero()).toDouble(); };
+	const auto& profiler = cmdEngine.getProfiler();
+	double right = seconds(time);
+	double range = timelineRange / 1000.0;
+	double left = right - range;
+
+	gl::vec2 pos = ImGui::GetCursorScreenPos();
+	gl::vec2 size{ImGui::GetContentRegionAvail().x, 2.0f * ImGui::GetFrameHeight()};
+	auto toX = [&](double t) {
+		return pos.x + size.x * float((std::clamp(t, left, right) - left) / range);
+	};
+	auto* drawList = ImGui::GetWindowDrawList();
+	drawList->AddRectFilled(pos, pos + size, ImGui::GetColorU32(ImGuiCol_FrameBg));
+	ImGui::InvisibleButton("##timeline", size);
+	bool hovered = ImGui::IsItemHovered();
+	float mouseX = ImGui::GetIO().MousePos.x;
+
+	// Walk from the most recent command back in time, until the left edge.
+	const VDPCmdProfileRecord* hoveredRecord = nullptr;
+	double busy = 0.0;
+	for (auto i = profiler.size(); i-- > 0; ) {
+		const auto& r = profiler[i];
+		double start = seconds(r.start);
+		double finish = r.inProgress() ? right : seconds(r.finish);
+		if (finish < left) break;
+		if (start > right) continue;
+		busy += std::min(finish, right) - std::max(start, left);
+		float x0 = toX(start);
+		float x1 = std::max(toX(finish), x0 + 1.0f);
+		auto color = ImColor::HSV(float(r.cmd) / float(VDPCmdCache::NUM_COMMANDS), 0.6f, 0.9f);
+		drawList->AddRectFilled(gl::vec2{x0, pos.y}, gl::vec2{x1, pos.y + size.y}, color);
+		if (hovered && (x0 <= mouseX) && (mouseX < x1)) hoveredRecord = &r;
+	}
+	ImGui::StrCat("Busy: ", int(100.0 * busy / range + 0.5), "%  Recorded commands: ", profiler.size());
+
+	if (hoveredRecord) {
+		const auto& r = *hoveredRecord;
+		im::Tooltip([&]{
+			ImGui::StrCat(commandNames[r.cmd], ' ', logOpNames[r.logOp],
+			              "  ", r.nx, 'x', r.ny, r.hs ? "  (high-speed)" : "");
+			if (r.inProgress()) {
+				ImGui::TextUnformatted("In progress"sv);
+			} else {
+				ImGui::Text("Duration: %.1fus%s", (r.finish - r.start).toDouble() * 1e6,
+				            r.aborted ? " (aborted)" : "");
+			}
+			ImGui::StrCat("Stolen access slots: ", r.stalls);
+			if (r.hs) {
+				for (auto i : xrange(VDPCmdCache::NUM_STATS)) {
+					ImGui::StrCat(statNames[i], ": ", r.cache[i]);
+				}
+			}
+		});
+	}
+}
+
 void ImGuiVdpRegs::paint(MSXMotherBoard* motherBoard)
 {
 	if (!show || !motherBoard) return;
@@ -829,6 +947,16 @@ void ImGuiVdpRegs::paint(MSXMotherBoard* motherBoard)
 			auto statusRegs = tms99x8 ? make_span(statusRegs1) : make_span(statusRegs2);
 			drawSection(statusRegs, registerValues, *vdp, time);
 		});
+		if (vdp->hasHS()) {
+			im::TreeNode("Command cache statistics", &openCacheStats, [&]{
+				drawCacheStats(vdp->getCmdEngine());
+			});
+		}
+		if (!tms99x8) {
+			im::TreeNode("Command timeline", &openCmdTimeline, [&]{
+				drawCmdTimeline(vdp->getCmdEngine(), time);
+			});
+		}
 		hoveredFunction = newHoveredFunction;
 
 		if (ImGui::IsWindowHovered() && ImGui::IsMouseReleased(ImGuiMouseButton_Right)) {
@@ -12,6 +12,7 @@ namespace openmsx {
 
 class ImGuiManager;
 class VDP;
+class VDPCmdEngine;
 
 class ImGuiVdpRegs final : public ImGuiPart
 {
@@ -26,6 +27,8 @@ public:
 private:
 	void drawSection(std::span<const uint8_t> showRegisters, std::span<const uint8_t> regValues,
 	                 VDP& vdp, EmuTime time);
+	void drawCacheStats(VDPCmdEngine& cmdEngine);
+	void drawCmdTimeline(VDPCmdEngine& cmdEngine, EmuTime time);
 
 public:
 	bool show = false;
@@ -43,6 +46,9 @@ private:
 	bool openV9958 = false;
 	bool openCommand = false;
 	bool openStatus = false;
+	bool openCacheStats = false;
+	bool openCmdTimeline = false;
+	int timelineRange = 40; // in ms
 
 	static constexpr auto persistentElements = std::tuple{
 		PersistentElement{"show",        &ImGuiVdpRegs::show},
@@ -55,7 +61,10 @@ private:
 		PersistentElement{"openAccess",  &ImGuiVdpRegs::openAccess},
 		PersistentElement{"openV9958",   &ImGuiVdpRegs::openV9958},
 		PersistentElement{"openCommand", &ImGuiVdpRegs::openCommand},
-		PersistentElement{"openStatus",  &ImGuiVdpRegs::openStatus}
+		PersistentElement{"openStatus",  &ImGuiVdpRegs::openStatus},
+		PersistentElement{"openCacheStats", &ImGuiVdpRegs::openCacheStats},
+		PersistentElement{"openCmdTimeline", &ImGuiVdpRegs::openCmdTimeline},
+		PersistentElementMinMax{"timelineRange", &ImGuiVdpRegs::timelineRange, 1, 1001}
 	};
 };
 
@@ -5,14 +5,19 @@
 #include "MSXCPU.hh"
 #include "MSXMotherBoard.hh"
 #include "StringSetting.hh"
+#include "serialize.hh"
 
 #include "narrow.hh"
 #include "xrange.hh"
 
+#include <algorithm>
 #include <cassert>
 
 namespace openmsx {
 
+// The pages handed out via getWriteCacheLine() are marked dirty as a whole.
+static_assert(CacheLine::SIZE <= DirtyPages::PAGE_SIZE);
+
 CheckedRam::CheckedRam(const DeviceConfig& config, const std::string& name,
                        static_string_view description, size_t size)
 	: ram(config, name, description, size)
@@ -36,7 +41,7 @@ uint8_t CheckedRam::read(size_t addr)
 			umrCallback.execute(narrow<int>(addr), ram.getName());
 		}
 	}
-	return ram[addr];
+	return ram.read(addr);
 }
 
 const uint8_t* CheckedRam::getReadCacheLine(size_t addr) const
@@ -48,20 +53,28 @@ const uint8_t* CheckedRam::getReadCacheLine(size_t addr) const
 uint8_t* CheckedRam::getWriteCacheLine(size_t addr)
 {
 	return (completely_initialized_cacheline[addr >> CacheLine::BITS])
-	     ? &ram[addr] : nullptr;
+	     ? ram.getWriteCacheLine(addr) : nullptr;
 }
 
-uint8_t* CheckedRam::getRWCacheLines(size_t addr, size_t size)
+bool CheckedRam::isInitialized(size_t addr, size_t size) const
 {
 	// TODO optimize
 	size_t num = size >> CacheLine::BITS;
 	size_t first = addr >> CacheLine::BITS;
-	for (auto i : xrange(num)) {
-		if (!completely_initialized_cacheline[first + i]) {
-			return nullptr;
-		}
-	}
-	return &ram[addr];
+	return std::ranges::all_of(xrange(num), [&](auto i) {
+		return completely_initialized_cacheline[first + i];
+	});
+}
+
+const uint8_t* CheckedRam::getReadCacheLines(size_t addr, size_t size) const
+{
+	return isInitialized(addr, size) ? &ram[addr] : nullptr;
+}
+
+uint8_t* CheckedRam::getRWCacheLines(size_t addr, size_t size)
+{
+	return isInitialized(addr, size)
+	     ? ram.getWriteBackdoor(addr, size).data() : nullptr;
 }
 
 void CheckedRam::write(size_t addr, const uint8_t value)
@@ -82,7 +95,7 @@ void CheckedRam::write(size_t addr, const uint8_t value)
 			msxcpu.invalidateAllSlotsRWCache(0, 0x10000);
 		}
 	}
-	ram[addr] = value;
+	ram.write(addr, value);
 }
 
 void CheckedRam::clear()
@@ -117,4 +130,16 @@ void CheckedRam::update(const Setting& setting) noexcept
 	init();
 }
 
+template<typename Archive>
+void CheckedRam::serialize(Archive& ar, unsigned version)
+{
+	ram.serialize(ar, version);
+	if (ar.isReverseSnapshot()) {
+		// The dirty-administration was just reset, so pointers handed
+		// out earlier (to the CPU) may no longer be used for writing.
+		msxcpu.invalidateAllSlotsRWCache(0, 0x10000);
+	}
+}
+INSTANTIATE_SERIALIZE_METHODS(CheckedRam);
+
 } // namespace openmsx
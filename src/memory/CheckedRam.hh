@@ -1,7 +1,7 @@
 #ifndef CHECKEDRAM_HH
 #define CHECKEDRAM_HH
 
-#include "Ram.hh"
+#include "TrackedRam.hh"
 
 #include "CacheLine.hh"
 #include "TclCallback.hh"
@@ -26,6 +26,10 @@ class Setting;
  * the turboR, only the normal memory mapper runs via CheckedRam. The RAM
  * accessed in DRAM mode or via the ROM mapper are unchecked! Note that there
  * is basically no overhead for using CheckedRam over Ram, thanks to Wouter.
+ *
+ * The written pages are also tracked for the reverse snapshots (see
+ * TrackedRam). Pointers handed out by getWriteCacheLine() mark their page
+ * dirty, so after each reverse snapshot the CPU caches are invalidated.
  */
 class CheckedRam final : private Observer<Setting>
 {
@@ -40,6 +44,7 @@ public:
 
 	[[nodiscard]] const uint8_t* getReadCacheLine(size_t addr) const;
 	[[nodiscard]] uint8_t* getWriteCacheLine(size_t addr);
+	[[nodiscard]] const uint8_t* getReadCacheLines(size_t addr, size_t size) const;
 	[[nodiscard]] uint8_t* getRWCacheLines(size_t addr, size_t size);
 
 	[[nodiscard]] size_t size() const { return ram.size(); }
@@ -51,14 +56,15 @@ public:
 	 * consistently, so that the initialized-administration will be always
 	 * up to date!
 	 */
-	[[nodiscard]] Ram& getUncheckedRam() { return ram; }
+	[[nodiscard]] TrackedRam& getUncheckedRam() { return ram; }
 
-	// TODO
-	//template<typename Archive>
-	//void serialize(Archive& ar, unsigned version);
+	// Same format as Ram, the initialized-administration is not stored.
+	template<typename Archive>
+	void serialize(Archive& ar, unsigned version);
 
 private:
 	void init();
+	[[nodiscard]] bool isInitialized(size_t addr, size_t size) const;
 
 	// Observer<Setting>
 	void update(const Setting& setting) noexcept override;
@@ -66,7 +72,7 @@ private:
 private:
 	std::vector<bool> completely_initialized_cacheline;
 	std::vector<std::bitset<CacheLine::SIZE>> uninitialized;
-	Ram ram;
+	TrackedRam ram;
 	MSXCPU& msxcpu;
 	TclCallback umrCallback;
 };
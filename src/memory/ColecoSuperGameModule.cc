@@ -176,8 +176,8 @@ byte* ColecoSuperGameModule::getWriteCacheLine(uint16_t start)
 template<typename Archive>
 void ColecoSuperGameModule::serialize(Archive& ar, unsigned /*version*/)
 {
-	ar.serialize("mainRam",          mainRam.getUncheckedRam(),
-	             "sgmRam",           sgmRam.getUncheckedRam(),
+	ar.serialize("mainRam",          mainRam,
+	             "sgmRam",           sgmRam,
 	             "psg",              psg,
 	             "psgLatch",         psgLatch,
 	             "ramEnabled",       ramEnabled,
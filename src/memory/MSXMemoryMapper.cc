@@ -13,11 +13,14 @@ void MSXMemoryMapper::writeIO(uint16_t port, byte value, EmuTime time)
 {
 	MSXMemoryMapperBase::writeIOImpl(port, value, time);
 	byte page = port & 3;
-	if (byte* data = checkedRam.getRWCacheLines(segmentOffset(page), 0x4000)) {
-		fillDeviceRWCache(page * 0x4000, 0x4000, data);
+	if (const byte* data = checkedRam.getReadCacheLines(segmentOffset(page), 0x4000)) {
+		fillDeviceRCache(page * 0x4000, 0x4000, data);
 	} else {
-		invalidateDeviceRWCache(page * 0x4000, 0x4000);
+		invalidateDeviceRCache(page * 0x4000, 0x4000);
 	}
+	// Write cache lines are filled on demand (via getWriteCacheLine()),
+	// that way only the actually written pages become dirty.
+	invalidateDeviceWCache(page * 0x4000, 0x4000);
 }
 
 template<typename Archive>
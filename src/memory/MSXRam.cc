@@ -72,8 +72,7 @@ template<typename Archive>
 void MSXRam::serialize(Archive& ar, unsigned /*version*/)
 {
 	ar.template serializeBase<MSXDevice>(*this);
-	// TODO ar.serialize("checkedRam", checkedRam);
-	ar.serialize("ram", checkedRam->getUncheckedRam());
+	ar.serialize("ram", *checkedRam);
 }
 INSTANTIATE_SERIALIZE_METHODS(MSXRam);
 REGISTER_MSXDEVICE(MSXRam, "Ram");
@@ -1,6 +1,5 @@
 #include "PanasonicMemory.hh"
 
-#include "Ram.hh"
 #include "Rom.hh"
 
 #include "DeviceConfig.hh"
@@ -32,7 +31,7 @@ PanasonicMemory::PanasonicMemory(MSXMotherBoard& motherBoard)
 {
 }
 
-void PanasonicMemory::registerRam(Ram& ram_)
+void PanasonicMemory::registerRam(std::span<uint8_t> ram_)
 {
 	ram = ram_.data();
 	ramSize = narrow<unsigned>(ram_.size());
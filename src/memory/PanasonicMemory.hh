@@ -5,12 +5,12 @@
 
 #include <cstdint>
 #include <optional>
+#include <span>
 
 namespace openmsx {
 
 class MSXMotherBoard;
 class MSXCPU;
-class Ram;
 
 class PanasonicMemory
 {
@@ -21,7 +21,7 @@ public:
 	 * Pass reference of the actual Ram block for use in DRAM mode and RAM
 	 * access via the ROM mapper. Note that this is always unchecked Ram!
 	 */
-	void registerRam(Ram& ram);
+	void registerRam(std::span<uint8_t> ram);
 	[[nodiscard]] std::span<const uint8_t, 0x2000> getRomBlock(unsigned block) const;
 	[[nodiscard]] std::span<const uint8_t> getRomRange(unsigned first, unsigned last) const;
 	/**
@@ -11,7 +11,8 @@ PanasonicRam::PanasonicRam(const DeviceConfig& config)
 	: MSXMemoryMapperBase(config)
 	, panasonicMemory(getMotherBoard().getPanasonicMemory())
 {
-	panasonicMemory.registerRam(checkedRam.getUncheckedRam());
+	// Written behind our back in DRAM mode and via the ROM mapper.
+	panasonicMemory.registerRam(checkedRam.getUncheckedRam().getUntrackedWriteBackdoor());
 }
 
 void PanasonicRam::writeMem(uint16_t address, byte value, EmuTime /*time*/)
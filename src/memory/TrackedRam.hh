@@ -3,21 +3,25 @@
 
 #include "Ram.hh"
 
+#include "DirtyPages.hh"
+
 #include <cstdint>
 
 namespace openmsx {
 
-// Ram with dirty tracking
+// Ram with dirty tracking, per page of DirtyPages::PAGE_SIZE bytes
 class TrackedRam
 {
 public:
 	// Most methods simply delegate to the internal 'ram' object.
 	TrackedRam(const DeviceConfig& config, const std::string& name,
 	           static_string_view description, size_t size)
-		: ram(config, name, description, size, &writeSinceLastReverseSnapshot) {}
+		: ram(config, name, description, size, &debugWrite)
+		, dirty(size) {}
 
 	TrackedRam(const XMLElement& xml, size_t size)
-		: ram(xml, size) {}
+		: ram(xml, size)
+		, dirty(size) {}
 
 	[[nodiscard]] size_t size() const {
 		return ram.size();
@@ -41,12 +45,12 @@ public:
 
 	// Only allow write/clear via an explicit method.
 	void write(size_t addr, uint8_t value) {
-		writeSinceLastReverseSnapshot = true;
+		dirty.set(addr);
 		ram[addr] = value;
 	}
 
 	void clear(uint8_t c = 0xff) {
-		writeSinceLastReverseSnapshot = true;
+		dirty.setAll();
 		ram.clear(c);
 	}
 
@@ -55,7 +59,30 @@ public:
 	// invocation, so the resulting pointer (although the same each time)
 	// should not be reused for multiple (distinct) bulk write operations.
 	[[nodiscard]] std::span<uint8_t> getWriteBackdoor() {
-		writeSinceLastReverseSnapshot = true;
+		dirty.setAll();
+		return {ram.data(), size()};
+	}
+
+	// Same as above, but only for (and only marking) the given range.
+	[[nodiscard]] std::span<uint8_t> getWriteBackdoor(size_t addr, size_t num) {
+		dirty.set(addr, num);
+		return {&ram[addr], num};
+	}
+
+	// Pointer for direct writes within the page that contains 'addr' (for
+	// example to fill the CPU cache). The page is marked dirty now, so
+	// the owner must make sure the pointer is no longer used after the
+	// next reverse snapshot.
+	[[nodiscard]] uint8_t* getWriteCacheLine(size_t addr) {
+		dirty.set(addr);
+		return &ram[addr];
+	}
+
+	// For memory that is also written via a pointer that's kept around
+	// (e.g. shared with another device). This disables the tracking: the
+	// whole ram is considered dirty on every snapshot.
+	[[nodiscard]] std::span<uint8_t> getUntrackedWriteBackdoor() {
+		untracked = true;
 		return {ram.data(), size()};
 	}
 
@@ -64,7 +91,9 @@ public:
 
 private:
 	Ram ram;
-	bool writeSinceLastReverseSnapshot = true;
+	DirtyPages dirty;
+	bool debugWrite = false; // set by the debuggable
+	bool untracked = false;
 };
 
 } // namespace openmsx
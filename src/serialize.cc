@@ -162,6 +162,24 @@ void MemOutputArchive::serialize_blob(const char* /*tag*/, std::span<const uint8
 	}
 }
 
+void MemOutputArchive::serialize_blob(const char* tag, std::span<const uint8_t> data,
+                                      DirtyPages& dirty)
+{
+	if (!reverseSnapshot) {
+		serialize_blob(tag, data);
+		return;
+	}
+	if (data.size() > SMALL_SIZE) {
+		auto deltaBlockIdx = unsigned(deltaBlocks.size());
+		save(deltaBlockIdx);
+		deltaBlocks.push_back(lastDeltaBlocks.createNew(data.data(), data, dirty));
+	} else {
+		auto buf = buffer.allocate(data.size());
+		copy_to_range(data, buf);
+	}
+	dirty.clear();
+}
+
 void MemInputArchive::serialize_blob(const char* /*tag*/, std::span<uint8_t> data,
                                      bool /*diff*/)
 {
@@ -175,13 +193,27 @@ void MemInputArchive::serialize_blob(const char* /*tag*/, std::span<uint8_t> dat
 		// is possible that certain blobs are stored in the savestate,
 		// but skipped while loading. That's why we do need the index.
 		unsigned deltaBlockIdx; load(deltaBlockIdx);
+		if ((deltaBlockIdx >= deltaBlocks.size()) ||
+		    (deltaBlocks[deltaBlockIdx]->getSize() != data.size())) {
+			// Can only happen for a damaged binary savestate file.
+			throw MSXException("Invalid savestate: mismatch in memory block ",
+			                   deltaBlockIdx);
+		}
 		deltaBlocks[deltaBlockIdx]->apply(data);
 	} else {
-		copy_to_range(std::span{buffer.getCurrentPos(), data.size()}, data);
-		buffer.skip(data.size());
+		const uint8_t* p = buffer.getCurrentPos();
+		buffer.skip(data.size()); // checks the size
+		copy_to_range(std::span{p, data.size()}, data);
 	}
 }
 
+void MemInputArchive::serialize_blob(const char* tag, std::span<uint8_t> data,
+                                     DirtyPages& dirty)
+{
+	serialize_blob(tag, data);
+	dirty.setAll();
+}
+
 ////
 
 XmlOutputArchive::XmlOutputArchive(zstring_view filename_)
@@ -558,4 +590,11 @@ void XmlInputArchive::serialize_blob(
 	}
 }
 
+void XmlInputArchive::serialize_blob(
+	const char* tag, std::span<uint8_t> data, DirtyPages& dirty)
+{
+	serialize_blob(tag, data);
+	dirty.setAll();
+}
+
 } // namespace openmsx
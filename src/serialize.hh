@@ -31,6 +31,7 @@ namespace openmsx {
 
 class LastDeltaBlocks;
 class DeltaBlock;
+class DirtyPages;
 
 // TODO move somewhere in utils once we use this more often
 struct HashPair {
@@ -151,6 +152,13 @@ public:
 	//   cannot know whether a byte-array should be serialized as a blob
 	//   or as a collection of bytes (IOW we cannot decide it based on the
 	//   type).
+	//
+	//
+	// void serialize_blob(const char* tag, std::span<uint8_t> data, DirtyPages& dirty)
+	//
+	//   Like above, but 'dirty' tracks which pages of the blob were written
+	//   since the previous reverse snapshot. Taking a reverse snapshot
+	//   clears it, loading marks everything dirty. Other archives ignore it.
 
 	template<typename T>
 	void serialize_blob(const char* tag, std::span<T> data, bool diff = true)
@@ -628,7 +636,15 @@ protected:
 
 
 // Enumerate all types which can be serialized using a simple memcpy. This
-// trait can be used by MemOutputArchive to apply certain optimizations.
+// trait is used by MemOutputArchive/MemInputArchive to store such values (and
+// arrays or vectors of them) as a single raw block instead of element per
+// element. The other archives don't use this trait, so e.g. the XML format is
+// not affected.
+// Only specialize this for trivially copyable types that have no padding and
+// whose serialize() method does nothing more than (un)serializing all members
+// (e.g. it doesn't recalculate derived state after loading). Note that the
+// memory archives can only be read back by the same openMSX build, so the
+// exact layout of such a type doesn't matter.
 template<typename T> struct SerializeAsMemcpy : std::false_type {};
 template<> struct SerializeAsMemcpy<         bool     > : std::true_type {};
 template<> struct SerializeAsMemcpy<         char     > : std::true_type {};
@@ -646,6 +662,7 @@ template<> struct SerializeAsMemcpy<         float    > : std::true_type {};
 template<> struct SerializeAsMemcpy<         double   > : std::true_type {};
 template<> struct SerializeAsMemcpy<    long double   > : std::true_type {};
 template<typename T, size_t N> struct SerializeAsMemcpy<std::array<T, N>> : SerializeAsMemcpy<T> {};
+template<typename T> requires(std::is_enum_v<T>) struct SerializeAsMemcpy<T> : std::true_type {};
 
 class MemOutputArchive final : public OutputArchiveBase<MemOutputArchive>
 {
@@ -679,6 +696,8 @@ public:
 	void save(std::string_view s);
 	void serialize_blob(const char* tag, std::span<const uint8_t> data,
 	                    bool diff = true);
+	void serialize_blob(const char* tag, std::span<const uint8_t> data,
+	                    DirtyPages& dirty);
 
 	using OutputArchiveBase<MemOutputArchive>::serialize;
 	template<typename T, typename ...Args>
@@ -692,11 +711,22 @@ public:
 		//   case).
 		serialize_group(std::tuple<>(), tag, t, std::forward<Args>(args)...);
 	}
-	template<typename T, size_t N>
-	ALWAYS_INLINE void serialize(const char* /*tag*/, const std::array<T, N>& t)
+	template<typename T>
+	ALWAYS_INLINE void serialize(const char* /*tag*/, const T& t)
 		requires(SerializeAsMemcpy<T>::value)
 	{
-		buffer.insert(t.data(), N * sizeof(T));
+		static_assert(std::is_trivially_copyable_v<T>);
+		buffer.insert(&t, sizeof(T));
+	}
+	template<typename T>
+	void serialize(const char* /*tag*/, const std::vector<T>& v)
+		requires(SerializeAsMemcpy<T>::value && !std::is_same_v<T, bool>)
+	{
+		// same layout as the generic collection code: size, then all items
+		static_assert(std::is_trivially_copyable_v<T>);
+		int n = int(v.size());
+		save(n);
+		buffer.insert(v.data(), v.size() * sizeof(T));
 	}
 
 	void beginSection()
@@ -787,6 +817,8 @@ public:
 	[[nodiscard]] std::string_view loadStr();
 	void serialize_blob(const char* tag, std::span<uint8_t> data,
 	                    bool diff = true);
+	void serialize_blob(const char* tag, std::span<uint8_t> data,
+	                    DirtyPages& dirty);
 
 	using InputArchiveBase<MemInputArchive>::serialize;
 	template<typename T, typename ...Args>
@@ -796,11 +828,41 @@ public:
 		serialize_group(std::tuple<>(), tag, t, std::forward<Args>(args)...);
 	}
 
-	template<typename T, size_t N>
-	ALWAYS_INLINE void serialize(const char* /*tag*/, std::array<T, N>& t)
-		requires(SerializeAsMemcpy<T>::value)
+	template<typename T>
+	ALWAYS_INLINE void serialize(const char* /*tag*/, T& t)
+		requires(SerializeAsMemcpy<std::remove_const_t<T>>::value)
 	{
-		buffer.read(t.data(), N * sizeof(T));
+		static_assert(std::is_trivially_copyable_v<std::remove_const_t<T>>);
+		buffer.read(const_cast<std::remove_const_t<T>*>(&t), sizeof(T));
+	}
+	template<typename T>
+	void serialize(const char* /*tag*/, std::vector<T>& v)
+		requires(SerializeAsMemcpy<T>::value && !std::is_same_v<T, bool>)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		int n;
+		load(n);
+		// read into a temporary, so 'v' stays consistent in case of errors
+		auto tmp = std::vector<T>(size_t(n));
+		buffer.read(tmp.data(), tmp.size() * sizeof(T));
+		v = std::move(tmp);
+	}
+
+/*internal*/
+	// Shadows the InputArchiveBase version: elements of collections are
+	// loaded via this method, read memcpy-able ones directly. Only when no
+	// id is stored, that's when they were saved via serialize().
+	template<typename T, typename TUPLE>
+	void doSerialize(const char* tag, T& t, TUPLE args, int id = 0)
+	{
+		if constexpr (SerializeAsMemcpy<std::remove_const_t<T>>::value &&
+		              (std::tuple_size_v<TUPLE> == 0)) {
+			if (id == -1) {
+				serialize(tag, t);
+				return;
+			}
+		}
+		InputArchiveBase<MemInputArchive>::doSerialize(tag, t, args, id);
 	}
 
 	void skipSection(bool skip)
@@ -882,6 +944,11 @@ public:
 
 	void serialize_blob(const char* tag, std::span<const uint8_t> data,
 	                    bool diff = true);
+	void serialize_blob(const char* tag, std::span<const uint8_t> data,
+	                    DirtyPages& /*dirty*/)
+	{
+		serialize_blob(tag, data);
+	}
 
 	auto& getXMLOutputStream() { return writer; }
 
@@ -951,6 +1018,8 @@ public:
 
 	void serialize_blob(const char* tag, std::span<uint8_t> data,
 	                    bool diff = true);
+	void serialize_blob(const char* tag, std::span<uint8_t> data,
+	                    DirtyPages& dirty);
 
 	void skipSection(bool /*skip*/) const { /*nothing*/ }
 
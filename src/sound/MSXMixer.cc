@@ -9,6 +9,7 @@
 #include "FileOperations.hh"
 #include "Filename.hh"
 #include "GlobalSettings.hh"
+#include "HostTimeProfile.hh"
 #include "IntegerSetting.hh"
 #include "MSXCliComm.hh"
 #include "MSXCommandController.hh"
@@ -153,6 +154,7 @@ double MSXMixer::getEffectiveSpeed() const
 
 void MSXMixer::updateStream(EmuTime time)
 {
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::SOUND);
 	unsigned count = prevTime.getTicksTill(time);
 	assert(count <= 8192);
 	inplace_buffer<StereoFloat, 8192> mixBuffer(uninitialized_tag{}, count);
@@ -452,6 +454,15 @@ void MSXMixer::generate(std::span<StereoFloat> output, EmuTime time)
 		return;
 	}
 
+	if (motherBoard.isFastForwarding()) {
+		// Nobody listens, only advance the state of the sound devices.
+		for (auto& info : infos) {
+			info.device->skipBuffer(samples, time);
+		}
+		std::ranges::fill(output, StereoFloat{});
+		return;
+	}
+
 	// +3 to allow processing samples in groups of 4 (and upto 3 samples
 	// more than requested).
 	inplace_buffer<float,       8192 + 3> monoBufExtra  (uninitialized_tag{}, samples + 3);
@@ -87,6 +87,16 @@ void MSXPSG::writeIO(uint16_t port, byte value, EmuTime time)
 	}
 }
 
+MSXDevice::ReadIOFunc MSXPSG::getReadIOFunc() const
+{
+	return &readIOThunk<MSXPSG>;
+}
+
+MSXDevice::WriteIOFunc MSXPSG::getWriteIOFunc() const
+{
+	return &writeIOThunk<MSXPSG>;
+}
+
 
 // AY8910Periphery
 byte MSXPSG::readA(EmuTime time)
@@ -26,6 +26,8 @@ public:
 	[[nodiscard]] byte readIO(uint16_t port, EmuTime time) override;
 	[[nodiscard]] byte peekIO(uint16_t port, EmuTime time) const override;
 	void writeIO(uint16_t port, byte value, EmuTime time) override;
+	[[nodiscard]] ReadIOFunc  getReadIOFunc()  const override;
+	[[nodiscard]] WriteIOFunc getWriteIOFunc() const override;
 
 	template<typename Archive>
 	void serialize(Archive& ar, unsigned version);
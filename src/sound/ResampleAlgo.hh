@@ -22,11 +22,24 @@ public:
 		return result;
 	}
 
+	/** Same as generateOutput(), except that no output is produced.
+	  * The input is still generated, so the state of the sound device
+	  * advances exactly as before. See SoundDevice::skipBuffer().
+	  */
+	void skipOutput(size_t num, EmuTime time)
+	{
+		skipOutputImpl(num, time);
+		const auto& emuClk = getEmuClock(); (void)emuClk;
+		assert(emuClk.getTime() <= time);
+		assert(emuClk.getFastAdd(1) > time);
+	}
+
 protected:
 	explicit ResampleAlgo(ResampledSoundDevice& input_) : input(input_) {}
 	[[nodiscard]] DynamicClock& getEmuClock() const { return input.getEmuClock(); }
 	virtual bool generateOutputImpl(float* dataOut, size_t num,
 	                                EmuTime time) = 0;
+	virtual void skipOutputImpl(size_t num, EmuTime time) = 0;
 
 protected:
 	ResampledSoundDevice& input;
@@ -108,6 +108,28 @@ bool ResampleBlip<CHANNELS>::generateOutputImpl(float* dataOut, size_t hostNum,
 	}
 }
 
+template<unsigned CHANNELS>
+void ResampleBlip<CHANNELS>::skipOutputImpl(size_t hostNum, EmuTime time)
+{
+	// Generate the input (to advance the sound device), but don't feed it
+	// to the blip buffers. 'lastInput' is left unchanged, so the next call
+	// to generateOutputImpl() resumes with the correct delta.
+	auto& emuClk = getEmuClock();
+	if (unsigned emuNum = emuClk.getTicksTill(time); emuNum > 0) {
+		const unsigned len = emuNum * CHANNELS + 3;
+		small_buffer<float, 8192> buf(uninitialized_tag{}, len);
+		bool ignore = input.generateInput(buf.data(), emuNum);
+		(void)ignore;
+		emuClk += emuNum;
+	}
+	// Keep the blip buffers in sync with the host clock.
+	small_buffer<float, 8192> out(uninitialized_tag{}, hostNum * CHANNELS + 3);
+	for (auto ch : xrange(CHANNELS)) {
+		bool ignore = blip[ch].template readSamples<CHANNELS>(out.data() + ch, hostNum);
+		(void)ignore;
+	}
+}
+
 // Force template instantiation.
 template class ResampleBlip<1>;
 template class ResampleBlip<2>;
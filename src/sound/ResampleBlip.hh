@@ -19,6 +19,7 @@ public:
 
 	bool generateOutputImpl(float* dataOut, size_t num,
 	                        EmuTime time) override;
+	void skipOutputImpl(size_t num, EmuTime time) override;
 
 private:
 	std::array<BlipBuffer, CHANNELS> blip;
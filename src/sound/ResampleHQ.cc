@@ -691,6 +691,20 @@ bool ResampleHQ<CHANNELS>::generateOutputImpl(
 	return notMuted;
 }
 
+template<unsigned CHANNELS>
+void ResampleHQ<CHANNELS>::skipOutputImpl(size_t /*hostNum*/, EmuTime time)
+{
+	// Same as above, but without the (expensive) filter calculations.
+	auto& emuClk = getEmuClock();
+	unsigned emuNum = emuClk.getTicksTill(time);
+	if (emuNum > 0) {
+		prepareData(emuNum);
+	}
+	emuClk += emuNum;
+	bufStart += emuNum;
+	nonzeroSamples = std::max<int>(0, nonzeroSamples - emuNum);
+}
+
 // Force template instantiation.
 template class ResampleHQ<1>;
 template class ResampleHQ<2>;
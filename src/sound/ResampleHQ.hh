@@ -28,6 +28,7 @@ public:
 
 	bool generateOutputImpl(float* dataOut, size_t num,
 	                        EmuTime time) override;
+	void skipOutputImpl(size_t num, EmuTime time) override;
 
 private:
 	void calcOutput(float pos, float* output);
@@ -13,6 +13,7 @@ public:
 	explicit ResampleTrivial(ResampledSoundDevice& input);
 	bool generateOutputImpl(float* dataOut, size_t num,
 	                        EmuTime time) override;
+	void skipOutputImpl(size_t num, EmuTime time) override;
 };
 
 } // namespace openmsx
@@ -43,6 +43,11 @@ bool ResampledSoundDevice::updateBuffer(size_t length, float* buffer,
 	return algo->generateOutput(buffer, length, time);
 }
 
+void ResampledSoundDevice::skipBuffer(size_t length, EmuTime time)
+{
+	algo->skipOutput(length, time);
+}
+
 bool ResampledSoundDevice::generateInput(float* buffer, size_t num)
 {
 	return mixChannels(buffer, num);
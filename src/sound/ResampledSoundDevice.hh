@@ -46,6 +46,7 @@ protected:
 	void setOutputRate(unsigned hostSampleRate, double speed) override;
 	bool updateBuffer(size_t length, float* buffer,
 	                  EmuTime time) override;
+	void skipBuffer(size_t length, EmuTime time) override;
 
 	// Observer<Setting>
 	void update(const Setting& setting) noexcept override;
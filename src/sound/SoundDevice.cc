@@ -198,6 +198,15 @@ std::span<const float> SoundDevice::getLastBuffer(unsigned channel)
 	return {&buf.buffer[buf.stopIdx - requestedSize], requestedSize};
 }
 
+void SoundDevice::skipBuffer(size_t length, EmuTime time)
+{
+	assert(length <= 8192);
+	// +3 see updateBuffer()
+	inplace_buffer<float, 2 * 8192 + 3> buf(uninitialized_tag{}, length * stereo + 3);
+	bool ignore = updateBuffer(length, buf.data(), time);
+	(void)ignore;
+}
+
 bool SoundDevice::mixChannels(float* dataOut, size_t samples)
 {
 	if (samples == 0) return true;
@@ -204,6 +204,13 @@ public: // Will be called by Mixer:
 	[[nodiscard]] virtual bool updateBuffer(size_t length, float* buffer,
 	                                        EmuTime time) = 0;
 
+	/** Like updateBuffer(), but the output is not needed (used while
+	  * fast-forwarding). The emulated state must still be advanced
+	  * exactly the same, but e.g. resampling can be skipped. The default
+	  * implementation calls updateBuffer() and discards the result.
+	  */
+	virtual void skipBuffer(size_t length, EmuTime time);
+
 protected:
 	/** Adds a number of samples that all have the same value.
 	  * Can be used to synthesize segments of a square wave.
@@ -932,6 +932,9 @@ static constexpr std::initializer_list<enum_string<YM2413NukeYKT::YM2413::EgStat
 };
 SERIALIZE_ENUM(YM2413NukeYKT::YM2413::EgState, egStateInfo);
 
+// Plain data, so in the memory archives 'writes' is stored as a single block.
+template<> struct SerializeAsMemcpy<YM2413NukeYKT::YM2413::Write> : std::true_type {};
+
 namespace YM2413NukeYKT {
 
 template<typename Archive>
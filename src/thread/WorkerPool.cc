@@ -0,0 +1,81 @@
+#include "WorkerPool.hh"
+
+#include "xrange.hh"
+
+#include <cassert>
+
+namespace openmsx {
+
+WorkerPool::~WorkerPool()
+{
+	stopWorkers();
+}
+
+void WorkerPool::setNumWorkers(unsigned num)
+{
+	if (num == workers.size()) return;
+	assert(!job);
+	stopWorkers();
+	stop = false;
+	workers.reserve(num);
+	for ([[maybe_unused]] auto i : xrange(num)) {
+		workers.emplace_back([this] { workerMain(); });
+	}
+}
+
+void WorkerPool::stopWorkers()
+{
+	{
+		std::scoped_lock lock(mutex);
+		stop = true;
+	}
+	wakeCond.notify_all();
+	for (auto& t : workers) t.join();
+	workers.clear();
+}
+
+void WorkerPool::run(unsigned numJobs_, const Job& job_)
+{
+	if (workers.empty() || (numJobs_ <= 1)) {
+		for (auto i : xrange(numJobs_)) job_(i);
+		return;
+	}
+
+	std::unique_lock lock(mutex);
+	assert(!job);
+	job = &job_;
+	numJobs = numJobs_;
+	nextJob = 0;
+	unfinished = numJobs_;
+	lock.unlock();
+	wakeCond.notify_all();
+
+	// Help the workers.
+	lock.lock();
+	while (hasWork()) {
+		unsigned i = nextJob++;
+		lock.unlock();
+		job_(i);
+		lock.lock();
+		--unfinished;
+	}
+	doneCond.wait(lock, [&] { return unfinished == 0; });
+	job = nullptr;
+}
+
+void WorkerPool::workerMain()
+{
+	std::unique_lock lock(mutex);
+	while (true) {
+		wakeCond.wait(lock, [&] { return stop || hasWork(); });
+		if (stop) return;
+		unsigned i = nextJob++;
+		const Job& j = *job;
+		lock.unlock();
+		j(i);
+		lock.lock();
+		if (--unfinished == 0) doneCond.notify_one();
+	}
+}
+
+} // namespace openmsx
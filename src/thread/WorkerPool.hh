@@ -0,0 +1,63 @@
+#ifndef WORKERPOOL_HH
+#define WORKERPOOL_HH
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace openmsx {
+
+/** A small pool of worker threads to execute a batch of independent jobs
+  * in parallel. The calling thread also executes jobs and run() only
+  * returns when the whole batch is finished. So the jobs can safely
+  * refer to the state of the caller.
+  */
+class WorkerPool
+{
+public:
+	using Job = std::function<void(unsigned)>;
+
+	WorkerPool() = default;
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool(WorkerPool&&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+	WorkerPool& operator=(WorkerPool&&) = delete;
+	~WorkerPool();
+
+	/** Change the number of worker threads (not counting the calling
+	  * thread). With zero workers, run() executes all jobs itself.
+	  * Must not be called while run() is in progress.
+	  */
+	void setNumWorkers(unsigned num);
+	[[nodiscard]] unsigned getNumWorkers() const {
+		return unsigned(workers.size());
+	}
+
+	/** Execute job(i) for all i in [0, numJobs), in an unspecified order
+	  * and possibly concurrently. Returns when all jobs are done.
+	  * Jobs must not throw.
+	  */
+	void run(unsigned numJobs, const Job& job);
+
+private:
+	void stopWorkers();
+	void workerMain();
+	[[nodiscard]] bool hasWork() const { return job && (nextJob < numJobs); }
+
+private:
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable wakeCond; // new batch or stop
+	std::condition_variable doneCond; // batch finished
+	const Job* job = nullptr; // current batch, nullptr if none
+	unsigned numJobs = 0;
+	unsigned nextJob = 0;    // first job that's not yet started
+	unsigned unfinished = 0; // number of jobs not yet finished
+	bool stop = false;
+};
+
+} // namespace openmsx
+
+#endif
@@ -0,0 +1,176 @@
+#include "catch.hpp"
+#include "BinarySavestate.hh"
+
+#include "DeltaBlock.hh"
+#include "MSXException.hh"
+#include "Version.hh"
+
+#include "endian.hh"
+#include "xrange.hh"
+
+#include <vector>
+
+using namespace openmsx;
+
+// See the format description in BinarySavestate.hh
+static constexpr size_t HEADER_SIZE = 8 + 4 + 4 + 4; // excluding version string
+static constexpr size_t ENTRY_SIZE = 4 + 4 + 8 + 8 + 8;
+
+static std::vector<uint8_t> makeData(size_t size, uint8_t seed)
+{
+	std::vector<uint8_t> result(size);
+	for (auto i : xrange(size)) result[i] = uint8_t((i / 16) + seed);
+	return result;
+}
+
+static void checkInvalid(std::span<const uint8_t> data)
+{
+	CHECK_THROWS_AS(BinarySavestate::decode(data), MSXException);
+}
+
+TEST_CASE("BinarySavestate")
+{
+	LastDeltaBlocks lastDeltaBlocks;
+	int id0 = 0, id1 = 0; // only the addresses are used
+	auto mem0 = makeData(5000, 0);
+	auto mem1 = makeData(300, 7);
+	auto state0 = makeData(100, 1);
+	auto state1 = makeData(3, 2); // too small to compress
+	std::vector<std::shared_ptr<DeltaBlock>> blocks0 = {
+		lastDeltaBlocks.createNew(&id0, mem0),
+		lastDeltaBlocks.createNew(&id1, mem1),
+	};
+	mem0[1234] = 0xff;
+	std::vector<std::shared_ptr<DeltaBlock>> blocks1 = {
+		lastDeltaBlocks.createNew(&id0, mem0),
+	};
+	std::vector<BinarySavestate::StateRef> refs = {
+		{.buffer = state0, .deltaBlocks = blocks0},
+		{.buffer = state1, .deltaBlocks = blocks1},
+	};
+	auto data = BinarySavestate::encode(refs);
+
+	auto tablePos = HEADER_SIZE + Version::full().size();
+	size_t numSections = 2 + 1 + 1;
+	REQUIRE(data.size() > (tablePos + numSections * ENTRY_SIZE));
+
+	SECTION("round trip") {
+		auto states = BinarySavestate::decode(data);
+		REQUIRE(states.size() == 2);
+		CHECK(std::ranges::equal(states[0].buffer, state0));
+		CHECK(std::ranges::equal(states[1].buffer, state1));
+		REQUIRE(states[0].deltaBlocks.size() == 2);
+		REQUIRE(states[1].deltaBlocks.size() == 1);
+
+		auto checkBlock = [](const DeltaBlock& block, const std::vector<uint8_t>& expected) {
+			std::vector<uint8_t> buf(expected.size());
+			block.apply(buf);
+			CHECK(buf == expected);
+		};
+		checkBlock(*states[1].deltaBlocks[0], mem0);
+		mem0[1234] = uint8_t(1234 / 16);
+		checkBlock(*states[0].deltaBlocks[0], mem0);
+		checkBlock(*states[0].deltaBlocks[1], mem1);
+	}
+	SECTION("truncated header") {
+		checkInvalid(std::span{data}.first(0));
+		checkInvalid(std::span{data}.first(7));
+		checkInvalid(std::span{data}.first(HEADER_SIZE - 1));
+		checkInvalid(std::span{data}.first(tablePos - 1));
+	}
+	SECTION("truncated section table") {
+		checkInvalid(std::span{data}.first(tablePos));
+		checkInvalid(std::span{data}.first(tablePos + numSections * ENTRY_SIZE - 1));
+	}
+	SECTION("truncated data") {
+		checkInvalid(std::span{data}.first(data.size() - 1));
+	}
+	SECTION("bad magic") {
+		data[0] ^= 1;
+		checkInvalid(data);
+		CHECK(!BinarySavestate::isBinarySavestate("/this/file/does/not/exist"));
+	}
+	SECTION("bad format version") {
+		Endian::write_UA_L32(&data[8], BinarySavestate::FORMAT_VERSION + 1);
+		checkInvalid(data);
+	}
+	SECTION("other openMSX version") {
+		data[HEADER_SIZE] ^= 1;
+		checkInvalid(data);
+	}
+	SECTION("too many sections") {
+		Endian::write_UA_L32(&data[12], 0xffff'ffff);
+		checkInvalid(data);
+	}
+	SECTION("no sections") {
+		Endian::write_UA_L32(&data[12], 0);
+		checkInvalid(data);
+	}
+	auto forAllEntries = [&](auto damage) {
+		for (auto i : xrange(numSections)) {
+			auto copy = data;
+			damage(&copy[tablePos + i * ENTRY_SIZE], copy);
+		}
+	};
+	SECTION("unknown section type") {
+		forAllEntries([](uint8_t* p, auto& copy) {
+			Endian::write_UA_L32(p + 0, 2);
+			checkInvalid(copy);
+		});
+	}
+	SECTION("section offset past the end") {
+		forAllEntries([](uint8_t* p, auto& copy) {
+			Endian::write_UA_L64(p + 8, copy.size() + 1);
+			checkInvalid(copy);
+			Endian::write_UA_L64(p + 8, uint64_t(-1));
+			checkInvalid(copy);
+		});
+	}
+	SECTION("section size past the end") {
+		forAllEntries([](uint8_t* p, auto& copy) {
+			Endian::write_UA_L64(p + 16, copy.size());
+			checkInvalid(copy);
+			Endian::write_UA_L64(p + 16, uint64_t(-1));
+			checkInvalid(copy);
+		});
+	}
+	SECTION("oversized raw size") {
+		forAllEntries([](uint8_t* p, auto& copy) {
+			Endian::write_UA_L64(p + 24, uint64_t(-1));
+			checkInvalid(copy);
+			Endian::write_UA_L64(p + 24, uint64_t(1) << 40);
+			checkInvalid(copy);
+		});
+	}
+	SECTION("wrong raw size") {
+		forAllEntries([](uint8_t* p, auto& copy) {
+			Endian::write_UA_L64(p + 24, Endian::read_UA_L64(p + 24) + 1);
+			checkInvalid(copy);
+		});
+	}
+	SECTION("toggled compression flag") {
+		forAllEntries([](uint8_t* p, auto& copy) {
+			Endian::write_UA_L32(p + 4, Endian::read_UA_L32(p + 4) ^ 1);
+			checkInvalid(copy);
+		});
+	}
+	SECTION("memory block before the first state") {
+		// swap the first two table entries: STATE <-> BLOB
+		auto* p = &data[tablePos];
+		std::swap_ranges(p, p + ENTRY_SIZE, p + ENTRY_SIZE);
+		checkInvalid(data);
+	}
+	SECTION("damaged data") {
+		// must either fail or succeed, but never crash
+		auto dataPos = tablePos + numSections * ENTRY_SIZE;
+		for (auto i : xrange(dataPos, data.size())) {
+			auto copy = data;
+			copy[i] ^= 0x5a;
+			try {
+				(void)BinarySavestate::decode(copy);
+			} catch (MSXException&) {
+				// ok
+			}
+		}
+	}
+}
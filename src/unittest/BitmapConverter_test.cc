@@ -0,0 +1,83 @@
+#include "catch.hpp"
+
+#include "BitmapConverter.hh"
+#include "xrange.hh"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace openmsx;
+using Pixel = BitmapConverter::Pixel;
+using Kernel = BitmapConverter::Kernel;
+
+// All kernels supported by this host must produce the same output as the
+// plain C++ implementation.
+static void check(BitmapConverter& converter, std::mt19937& rng, bool planar)
+{
+	std::uniform_int_distribution<unsigned> dist(0, 255);
+	std::array<uint8_t, 128> vram0, vram1;
+	for (auto i : xrange(128)) {
+		vram0[i] = uint8_t(dist(rng));
+		vram1[i] = uint8_t(dist(rng));
+	}
+
+	auto convert = [&](Kernel kernel) {
+		std::array<Pixel, 512> buf;
+		buf.fill(0);
+		converter.setKernel(kernel);
+		if (planar) {
+			converter.convertLinePlanar(buf, vram0, vram1);
+		} else {
+			converter.convertLine(buf, vram0);
+		}
+		return buf;
+	};
+	auto expected = convert(Kernel::SCALAR);
+	for (auto kernel : {Kernel::SSE2, Kernel::AVX2}) {
+		if (!BitmapConverter::isSupported(kernel)) continue;
+		INFO("kernel " << int(kernel));
+		CHECK(convert(kernel) == expected);
+	}
+}
+
+TEST_CASE("BitmapConverter")
+{
+	std::mt19937 rng(12345);
+	// Distinct values in all palettes, so that any wrong lookup is noticed.
+	std::vector<Pixel> palette16(256), palette16odd(16), palette256(256), palette32768(32768);
+	Pixel val = 0x01000000;
+	for (auto& p : palette16)    p = val++;
+	for (auto& p : palette16odd) p = val++;
+	for (auto& p : palette256)   p = val++;
+	for (auto& p : palette32768) p = val++;
+	BitmapConverter converter{
+		std::span<const Pixel, 256>  (palette16),
+		std::span<const Pixel, 16>   (palette16odd),
+		std::span<const Pixel, 256>  (palette256),
+		std::span<const Pixel, 32768>(palette32768)};
+
+	struct Test { uint8_t reg0, reg25; bool planar; };
+	for (auto [reg0, reg25, planar] : {
+			Test{0x06, 0x00, false}, // Graphic4
+			Test{0x08, 0x00, false}, // Graphic5
+			Test{0x0A, 0x00, true},  // Graphic6
+			Test{0x0E, 0x00, true},  // Graphic7
+			Test{0x0E, 0x08, true},  // Graphic7 + YJK
+			Test{0x0E, 0x18, true}}) { // Graphic7 + YJK + YAE
+		converter.setDisplayMode(DisplayMode(reg0, 0x00, reg25));
+		for (bool epal : {false, true}) {
+			converter.setEPAL(epal);
+			for ([[maybe_unused]] auto rep : xrange(100)) {
+				check(converter, rng, planar);
+			}
+		}
+	}
+
+	// Palette changes must be picked up by both implementations.
+	palette16[5] = 0x12345678;
+	converter.palette16Changed();
+	converter.setDisplayMode(DisplayMode(0x06, 0x00, 0x00));
+	check(converter, rng, false);
+}
@@ -0,0 +1,67 @@
+#include "catch.hpp"
+
+#include "CPUProfile.hh"
+#include "SymbolManager.hh"
+
+#include <vector>
+
+using namespace openmsx;
+
+static CPUProfile::Location loc(uint16_t pc, uint8_t ps, std::optional<uint8_t> ss = {},
+                                std::optional<uint16_t> segment = {})
+{
+	return {.pc = pc, .ps = ps, .ss = ss, .segment = segment};
+}
+
+TEST_CASE("CPUProfile")
+{
+	std::vector<SymbolFile> files(1);
+	auto& symbols = files[0].symbols;
+	symbols.push_back({.name = "main",     .value = 0x4010, .slot = {}, .segment = {}});
+	symbols.push_back({.name = "loop",     .value = 0x4020, .slot = {}, .segment = {}});
+	symbols.push_back({.name = "bank2fn",  .value = 0x8000, .slot = {}, .segment = 2});
+	symbols.push_back({.name = "bank3fn",  .value = 0x8000, .slot = {}, .segment = 3});
+	symbols.push_back({.name = "slot1fn",  .value = 0x8100, .slot = 1,  .segment = 3});
+	symbols.push_back({.name = "fallback", .value = 0x8100, .slot = {}, .segment = {}});
+
+	CPUProfile profile;
+	CHECK(profile.getNumSamples() == 0);
+	CHECK(profile.formatCollapsed(files).empty());
+
+	for (int i = 0; i < 5; ++i) profile.add(loc(0x4025, 1)); // loop
+	for (int i = 0; i < 2; ++i) profile.add(loc(0x4020, 1)); // loop
+	for (int i = 0; i < 3; ++i) profile.add(loc(0x4012, 1)); // main
+	profile.add(loc(0x4005, 1));                // no symbol at or below
+	profile.add(loc(0xC000, 1));                // symbols in other page don't match
+	profile.add(loc(0x8004, 2, 0, 3));          // bank3fn
+	profile.add(loc(0x8104, 1, {}, 3));         // slot1fn (matches slot and segment)
+	profile.add(loc(0x8104, 2, 1, 3));          // fallback (slot mismatch)
+	profile.add(loc(0x8004, 2, 0, 7));          // segment mismatch, no other candidate
+	CHECK(profile.getNumSamples() == 16);
+
+	CHECK(profile.formatCollapsed(files) ==
+		"slot 1;segment -;loop 7\n"
+		"slot 1;segment -;main 3\n"
+		"slot 1;segment -;0x4005 1\n"
+		"slot 2-0;segment 7;0x8004 1\n"
+		"slot 1;segment -;0xc000 1\n"
+		"slot 2-0;segment 3;bank3fn 1\n"
+		"slot 2-1;segment 3;fallback 1\n"
+		"slot 1;segment 3;slot1fn 1\n");
+
+	CHECK(profile.formatFlat(files, 2) ==
+		"total samples: 16\n"
+		"  samples      %  slot  segment  function\n"
+		"        7   43.8  1     -        loop\n"
+		"        3   18.8  1     -        main\n");
+
+	// without symbols, every address is reported separately
+	CHECK(profile.formatCollapsed({}).starts_with(
+		"slot 1;segment -;0x4025 5\n"
+		"slot 1;segment -;0x4012 3\n"
+		"slot 1;segment -;0x4020 2\n"));
+
+	profile.clear();
+	CHECK(profile.getNumSamples() == 0);
+	CHECK(profile.formatCollapsed(files).empty());
+}
@@ -0,0 +1,98 @@
+#include "catch.hpp"
+#include "MemoryBufferFile.hh"
+
+#include "CPUTrace.hh"
+#include "MSXException.hh"
+
+#include "endian.hh"
+#include "lz4.hh"
+
+#include <sstream>
+#include <vector>
+
+using namespace openmsx;
+
+static std::vector<uint8_t> makeTrace(std::span<const uint8_t> compressed, uint32_t rawSize)
+{
+	std::vector<uint8_t> result(CPUTraceWriter::MAGIC.begin(), CPUTraceWriter::MAGIC.end());
+	auto pos = result.size();
+	result.resize(pos + 8);
+	Endian::write_UA_L32(&result[pos + 0], rawSize);
+	Endian::write_UA_L32(&result[pos + 4], uint32_t(compressed.size()));
+	result.insert(result.end(), compressed.begin(), compressed.end());
+	return result;
+}
+
+static std::vector<uint8_t> compress(std::span<const uint8_t> raw)
+{
+	std::vector<uint8_t> result(LZ4::compressBound(int(raw.size())));
+	result.resize(LZ4::compress(raw.data(), result.data(), int(raw.size())));
+	return result;
+}
+
+static std::string decode(std::span<const uint8_t> trace, bool showSlots = false)
+{
+	File file = memory_buffer_file(trace);
+	std::ostringstream out;
+	decodeCPUTrace(file, out, false, showSlots);
+	return out.str();
+}
+
+TEST_CASE("CPUTrace: decode")
+{
+	// one record: 'nop' at address 0x4000, no registers, no slots
+	std::array<uint8_t, 6> raw = {0x00, 0x00, 0x00, 0x00, 0x40, 0x00};
+	auto compressed = compress(raw);
+
+	SECTION("valid") {
+		auto trace = makeTrace(compressed, uint32_t(raw.size()));
+		auto text = decode(trace);
+		CHECK(text.starts_with("4000 : nop"));
+	}
+	SECTION("wrong raw size") {
+		auto trace = makeTrace(compressed, uint32_t(raw.size() + 1));
+		CHECK_THROWS_AS(decode(trace), MSXException);
+	}
+	SECTION("truncated block") {
+		auto trace = makeTrace(compressed, uint32_t(raw.size()));
+		trace.pop_back();
+		CHECK_THROWS_AS(decode(trace), MSXException);
+	}
+	SECTION("match offset before start of block") {
+		// literal 'A', followed by a match at offset 0xffff
+		std::array<uint8_t, 4> corrupt = {0x10, 'A', 0xff, 0xff};
+		auto trace = makeTrace(corrupt, uint32_t(raw.size()));
+		CHECK_THROWS_AS(decode(trace), MSXException);
+	}
+	SECTION("literal run longer than the block") {
+		std::array<uint8_t, 5> corrupt = {0xf0, 0xff, 0xff, 0x00, 0x00};
+		auto trace = makeTrace(corrupt, uint32_t(raw.size()));
+		CHECK_THROWS_AS(decode(trace), MSXException);
+	}
+	SECTION("bad magic") {
+		auto trace = makeTrace(compressed, uint32_t(raw.size()));
+		trace[0] ^= 1;
+		CHECK_THROWS_AS(decode(trace), MSXException);
+	}
+}
+
+TEST_CASE("CPUTrace: slots and segments")
+{
+	// 'nop' at 0x4000, with slots 3-0, 3-1, 0-0, 3-3 and a memory mapper
+	// in pages 0 and 1
+	std::array<uint8_t, 13> raw = {
+		0x14, 0x00, 0x00, 0x00, 0x40, 0x00,
+		0x03, 0x07, 0x00, 0x0F,
+		0x03, 0x12, 0x34};
+	auto compressed = compress(raw);
+
+	SECTION("valid") {
+		auto trace = makeTrace(compressed, uint32_t(raw.size()));
+		CHECK(decode(trace, true).ends_with(" slots=3-0:12,3-1:34,0-0,3-3\n"));
+	}
+	SECTION("truncated segments") {
+		auto truncated = std::span{raw}.first(raw.size() - 1);
+		auto trace = makeTrace(compress(truncated), uint32_t(truncated.size()));
+		CHECK_THROWS_AS(decode(trace), MSXException);
+	}
+}
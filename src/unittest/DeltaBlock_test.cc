@@ -0,0 +1,143 @@
+#include "catch.hpp"
+#include "DeltaBlock.hh"
+
+#include "xrange.hh"
+
+#include <algorithm>
+#include <vector>
+
+using namespace openmsx;
+
+static void checkApply(const DeltaBlock& block, const std::vector<uint8_t>& expected)
+{
+	std::vector<uint8_t> buf(expected.size(), 0x55);
+	block.apply(buf);
+	CHECK(buf == expected);
+}
+
+TEST_CASE("DirtyPages")
+{
+	DirtyPages dirty(1000); // 4 pages, last one partial
+	CHECK(dirty.size() == 4);
+	CHECK(dirty.any());
+	dirty.clear();
+	CHECK(!dirty.any());
+
+	dirty.set(0x1ff);
+	dirty.set(0x2ff, 2); // crosses a page boundary
+	CHECK(!dirty.test(0));
+	CHECK( dirty.test(1));
+	CHECK( dirty.test(2));
+	CHECK( dirty.test(3));
+
+	std::vector<std::pair<size_t, size_t>> ranges;
+	dirty.forEachRange([&](size_t b, size_t e) { ranges.emplace_back(b, e); });
+	CHECK(ranges == std::vector<std::pair<size_t, size_t>>{{1, 4}});
+
+	DirtyPages big(0x10000); // 256 pages
+	big.clear();
+	big.set(0x0000);
+	big.set(0x4100);
+	big.set(0xff00, 0x100);
+	ranges.clear();
+	big.forEachRange([&](size_t b, size_t e) { ranges.emplace_back(b, e); });
+	CHECK(ranges == std::vector<std::pair<size_t, size_t>>{{0, 1}, {0x41, 0x42}, {0xff, 0x100}});
+
+	DirtyPages small(0x400);
+	small.clear();
+	small |= big; // additional pages of 'big' are ignored
+	CHECK( small.test(0));
+	CHECK(!small.test(1));
+	CHECK(!small.test(3));
+}
+
+TEST_CASE("LastDeltaBlocks")
+{
+	std::vector<uint8_t> data(0x10000);
+	for (auto i : xrange(data.size())) data[i] = uint8_t(i * 7);
+	DirtyPages dirty(data.size());
+	LastDeltaBlocks lastBlocks;
+
+	// first block is a full copy
+	auto b0 = lastBlocks.createNew(data.data(), data, dirty);
+	checkApply(*b0, data);
+	dirty.clear();
+
+	// nothing written: previous block is reused
+	auto b1 = lastBlocks.createNew(data.data(), data, dirty);
+	CHECK(b1 == b0);
+
+	// only the dirty pages are compared
+	data[0x1234] = 1;
+	dirty.set(0x1234);
+	auto b2 = lastBlocks.createNew(data.data(), data, dirty);
+	CHECK(b2 != b0);
+	checkApply(*b2, data);
+	dirty.clear();
+
+	// earlier changes (relative to the reference copy) are retained
+	auto before = data;
+	std::ranges::fill(std::span{data}.subspan(0x8000, 0x300), 0xAA);
+	dirty.set(0x8000, 0x300);
+	auto b3 = lastBlocks.createNew(data.data(), data, dirty);
+	checkApply(*b3, data);
+	checkApply(*b2, before);
+	dirty.clear();
+
+	// a write that restores the original value
+	data[0x1234] = uint8_t(0x1234 * 7);
+	dirty.set(0x1234);
+	auto b4 = lastBlocks.createNew(data.data(), data, dirty);
+	checkApply(*b4, data);
+
+	// without dirty information everything is compared
+	data[0xffff] = 0;
+	auto b5 = lastBlocks.createNew(data.data(), data);
+	checkApply(*b5, data);
+}
+
+TEST_CASE("LastDeltaBlocks: background compression")
+{
+	std::vector<uint8_t> data(0x1000, 0);
+	std::vector<std::shared_ptr<DeltaBlock>> blocks;
+	std::vector<std::vector<uint8_t>> expected;
+	LastDeltaBlocks lastBlocks;
+
+	// Many changes, so that the reference copy gets replaced (and the old
+	// one compressed) a couple of times.
+	for (auto i : xrange(64)) {
+		for (auto j : xrange(0x100)) data[(i * 0x100 + j * 13) % data.size()] += uint8_t(j);
+		blocks.push_back(lastBlocks.createNew(data.data(), data));
+		expected.push_back(data);
+		if (i == 10) {
+			// dropped before (or during) compression
+			blocks.clear();
+			expected.clear();
+		}
+	}
+	// blocks can be applied before, during and after compression
+	for (auto i : xrange(blocks.size())) checkApply(*blocks[i], expected[i]);
+	lastBlocks.clear();
+	for (auto i : xrange(blocks.size())) checkApply(*blocks[i], expected[i]);
+	lastBlocks.sync();
+	for (auto i : xrange(blocks.size())) checkApply(*blocks[i], expected[i]);
+}
+
+TEST_CASE("DeltaBlock: memory usage")
+{
+	std::vector<uint8_t> data(0x10000);
+	for (auto i : xrange(data.size())) data[i] = uint8_t(i * 7);
+	LastDeltaBlocks lastBlocks;
+
+	// first block is a full copy
+	auto b0 = lastBlocks.createNew(data.data(), data);
+	CHECK(b0->getMemoryUsage() == data.size());
+	CHECK(b0->getReference() == nullptr);
+
+	// a small change is stored relative to that copy
+	data[0x1234] = 1;
+	auto b1 = lastBlocks.createNew(data.data(), data);
+	CHECK(b1->getReference() == b0.get());
+	CHECK(b1->getMemoryUsage() < 100);
+	checkApply(*b1, data);
+}
@@ -0,0 +1,59 @@
+#include "catch.hpp"
+#include "VDPVRAM.hh"
+
+#include "DeltaBlock.hh"
+
+#include "xrange.hh"
+
+#include <vector>
+
+using namespace openmsx;
+
+static void checkApply(const DeltaBlock& block, const std::vector<uint8_t>& expected)
+{
+	std::vector<uint8_t> buf(expected.size(), 0x55);
+	block.apply(buf);
+	CHECK(buf == expected);
+}
+
+TEST_CASE("VDPVRAM: 4k/8k mapping")
+{
+	std::vector<uint8_t> vram(0x4000);
+	for (auto i : xrange(vram.size())) vram[i] = uint8_t(i ^ (i >> 6));
+	auto orig = vram;
+	auto remap = [&](DirtyPages& dirty, bool mapping8k) {
+		VDPVRAM::remap4k8k(std::span<uint8_t, 0x4000>(vram), dirty, mapping8k);
+	};
+
+	SECTION("round trip") {
+		DirtyPages dirty(vram.size());
+		remap(dirty, true);
+		CHECK(vram != orig);
+		CHECK(vram[0x0040] == orig[0x1000]);
+		CHECK(vram[0x0080] == orig[0x0040]);
+		CHECK(vram[0x2000] == orig[0x2000]);
+		remap(dirty, false);
+		CHECK(vram == orig);
+	}
+	SECTION("reverse snapshots") {
+		// Toggle the mapping in between two snapshots, the second
+		// snapshot must see the permuted layout.
+		DirtyPages dirty(vram.size());
+		LastDeltaBlocks lastBlocks;
+		auto b0 = lastBlocks.createNew(vram.data(), vram, dirty);
+		dirty.clear();
+
+		remap(dirty, true);
+		auto permuted = vram;
+		for (auto page : xrange(dirty.size())) CHECK(dirty.test(page));
+		auto b1 = lastBlocks.createNew(vram.data(), vram, dirty);
+		dirty.clear();
+
+		remap(dirty, false);
+		auto b2 = lastBlocks.createNew(vram.data(), vram, dirty);
+
+		checkApply(*b0, orig);
+		checkApply(*b1, permuted);
+		checkApply(*b2, orig);
+	}
+}
@@ -0,0 +1,45 @@
+#include "catch.hpp"
+
+#include "WorkerPool.hh"
+#include "xrange.hh"
+
+#include <atomic>
+#include <vector>
+
+using namespace openmsx;
+
+static void check(WorkerPool& pool, unsigned numJobs)
+{
+	std::vector<std::atomic<int>> count(numJobs);
+	pool.run(numJobs, [&](unsigned i) { ++count[i]; });
+	for (auto i : xrange(numJobs)) {
+		CHECK(count[i] == 1);
+	}
+}
+
+TEST_CASE("WorkerPool")
+{
+	WorkerPool pool;
+	CHECK(pool.getNumWorkers() == 0);
+	check(pool, 0);
+	check(pool, 1);
+	check(pool, 7);
+
+	pool.setNumWorkers(3);
+	CHECK(pool.getNumWorkers() == 3);
+	for (auto numJobs : {0u, 1u, 2u, 3u, 4u, 100u}) {
+		check(pool, numJobs);
+	}
+	// run many small batches to shake out synchronization problems
+	for ([[maybe_unused]] auto rep : xrange(1000)) {
+		check(pool, 5);
+	}
+
+	pool.setNumWorkers(1);
+	CHECK(pool.getNumWorkers() == 1);
+	check(pool, 10);
+
+	pool.setNumWorkers(0);
+	CHECK(pool.getNumWorkers() == 0);
+	check(pool, 10);
+}
@@ -0,0 +1,100 @@
+#include "catch.hpp"
+#include "lz4.hh"
+
+#include "xrange.hh"
+
+#include <array>
+#include <vector>
+
+static std::vector<uint8_t> makeData(size_t size)
+{
+	// compressible, but not trivially so
+	std::vector<uint8_t> result(size);
+	for (auto i : xrange(size)) {
+		result[i] = uint8_t((i % 97) < 50 ? (i / 7) : (i * 13));
+	}
+	return result;
+}
+
+static std::vector<uint8_t> compress(const std::vector<uint8_t>& data)
+{
+	std::vector<uint8_t> result(LZ4::compressBound(int(data.size())));
+	result.resize(LZ4::compress(data.data(), result.data(), int(data.size())));
+	return result;
+}
+
+template<size_t N>
+static int decompressSafe(const std::array<uint8_t, N>& src, size_t dstCapacity)
+{
+	std::vector<uint8_t> dst(dstCapacity);
+	return LZ4::decompressSafe(src.data(), dst.data(), int(N), int(dstCapacity));
+}
+
+TEST_CASE("LZ4: round trip")
+{
+	for (size_t size : {1, 15, 100, 4096, 100000}) {
+		auto data = makeData(size);
+		auto compressed = compress(data);
+
+		std::vector<uint8_t> out(size);
+		CHECK(LZ4::decompressSafe(compressed.data(), out.data(), int(compressed.size()), int(size)) == int(size));
+		CHECK(out == data);
+
+		std::ranges::fill(out, 0);
+		CHECK(LZ4::decompress(compressed.data(), out.data(), int(compressed.size()), int(size)) == int(size));
+		CHECK(out == data);
+
+		// output doesn't fit
+		CHECK(LZ4::decompressSafe(compressed.data(), out.data(), int(compressed.size()), int(size - 1)) == -1);
+	}
+}
+
+TEST_CASE("LZ4: malformed input")
+{
+	// empty input
+	CHECK(LZ4::decompressSafe(nullptr, nullptr, 0, 0) == -1);
+
+	// 3 literals announced, only 2 present
+	CHECK(decompressSafe(std::array<uint8_t, 3>{0x30, 'A', 'B'}, 100) == -1);
+	// literal run with length extension (15 + 255 + 255), input too short
+	CHECK(decompressSafe(std::array<uint8_t, 5>{0xf0, 0xff, 0xff, 0x00, 'A'}, 1000) == -1);
+	// length extension runs past the end of the input
+	CHECK(decompressSafe(std::array<uint8_t, 2>{0xf0, 0xff}, 1000) == -1);
+	// literals don't fit in the output
+	CHECK(decompressSafe(std::array<uint8_t, 4>{0x30, 'A', 'B', 'C'}, 2) == -1);
+
+	// match offset before the start of the output
+	CHECK(decompressSafe(std::array<uint8_t, 4>{0x10, 'A', 0x02, 0x00}, 100) == -1);
+	CHECK(decompressSafe(std::array<uint8_t, 4>{0x10, 'A', 0xff, 0xff}, 100) == -1);
+	// offset zero
+	CHECK(decompressSafe(std::array<uint8_t, 4>{0x10, 'A', 0x00, 0x00}, 100) == -1);
+	// truncated offset
+	CHECK(decompressSafe(std::array<uint8_t, 3>{0x10, 'A', 0x01}, 100) == -1);
+	// match doesn't fit in the output (1 literal + 4 match bytes)
+	CHECK(decompressSafe(std::array<uint8_t, 4>{0x10, 'A', 0x01, 0x00}, 4) == -1);
+	// match without a following (last) literal sequence
+	CHECK(decompressSafe(std::array<uint8_t, 4>{0x10, 'A', 0x01, 0x00}, 100) == -1);
+	// ... but with one it's fine: 'A' + 4x 'A' + 'B'
+	CHECK(decompressSafe(std::array<uint8_t, 6>{0x10, 'A', 0x01, 0x00, 0x10, 'B'}, 100) == 6);
+}
+
+TEST_CASE("LZ4: damaged stream")
+{
+	// Damage a valid stream in many ways, the result must either be an
+	// error or fit in the output buffer.
+	auto data = makeData(1000);
+	auto compressed = compress(data);
+	std::vector<uint8_t> out(data.size());
+	for (auto i : xrange(compressed.size())) {
+		for (uint8_t x : {0x01, 0x10, 0x80, 0xff}) {
+			auto damaged = compressed;
+			damaged[i] ^= x;
+			auto r = LZ4::decompressSafe(damaged.data(), out.data(), int(damaged.size()), int(out.size()));
+			CHECK(r >= -1);
+			CHECK(r <= int(out.size()));
+		}
+		// truncated
+		auto r = LZ4::decompressSafe(compressed.data(), out.data(), int(i), int(out.size()));
+		CHECK(r != int(out.size()));
+	}
+}
@@ -184,41 +184,61 @@ end:	return std::mismatch(p, p_end, q);
 //   n2 number of bytes are different, and here are the bytes
 //   n3 number of bytes are equal
 //   ...
+// When 'changed' is given, only those pages are compared. All other pages are
+// known to be equal, they're not even looked at.
 [[nodiscard]] static std::vector<uint8_t> calcDelta(
-	const uint8_t* oldBuf, std::span<const uint8_t> newBuf)
+	const uint8_t* oldBuf, std::span<const uint8_t> newBuf,
+	const DirtyPages* changed)
 {
 	std::vector<uint8_t> result;
+	size_t equal = 0; // number of equal bytes, not yet stored
 
-	const auto* p = oldBuf;
-	const auto* q = newBuf.data();
-	auto size = newBuf.size();
-	const auto* p_end = p + size;
-	const auto* q_end = q + size;
+	auto scanRange = [&](size_t begin, size_t end) {
+		const auto* p = oldBuf + begin;
+		const auto* q = newBuf.data() + begin;
+		const auto* p_end = oldBuf + end;
+		const auto* q_end = newBuf.data() + end;
 
-	// scan equal bytes (possibly zero)
-	const auto* q1 = q;
-	std::tie(p, q) = scan_mismatch(p, p_end, q, q_end);
-	auto n1 = q - q1;
-	storeUleb(result, n1);
+		// scan equal bytes (possibly zero)
+		const auto* q1 = q;
+		std::tie(p, q) = scan_mismatch(p, p_end, q, q_end);
+		equal += q - q1;
 
-	while (q != q_end) {
-		assert(*p != *q);
+		while (q != q_end) {
+			assert(*p != *q);
 
-		const auto* q2 = q;
-	different:
-		std::tie(p, q) = scan_match(p + 1, p_end, q + 1, q_end);
-		auto n2 = q - q2;
+			const auto* q2 = q;
+		different:
+			std::tie(p, q) = scan_match(p + 1, p_end, q + 1, q_end);
+			auto n2 = q - q2;
 
-		const auto* q3 = q;
-		std::tie(p, q) = scan_mismatch(p, p_end, q, q_end);
-		auto n3 = q - q3;
-		if ((q != q_end) && (n3 <= 2)) goto different;
+			const auto* q3 = q;
+			std::tie(p, q) = scan_mismatch(p, p_end, q, q_end);
+			auto n3 = q - q3;
+			if ((q != q_end) && (n3 <= 2)) goto different;
 
-		storeUleb(result, n2);
-		result.insert(result.end(), q2, q3);
+			storeUleb(result, equal);
+			storeUleb(result, n2);
+			result.insert(result.end(), q2, q3);
+			equal = n3;
+		}
+	};
 
-		if (n3 != 0) storeUleb(result, n3);
+	auto size = newBuf.size();
+	if (changed) {
+		size_t pos = 0;
+		changed->forEachRange([&](size_t firstPage, size_t lastPage) {
+			auto begin = firstPage << DirtyPages::PAGE_BITS;
+			auto end = std::min(lastPage << DirtyPages::PAGE_BITS, size);
+			equal += begin - pos;
+			scanRange(begin, end);
+			pos = end;
+		});
+		equal += size - pos;
+	} else {
+		scanRange(0, size);
 	}
+	if ((equal != 0) || result.empty()) storeUleb(result, equal);
 
 	result.shrink_to_fit();
 	return result;
@@ -255,7 +275,8 @@ DeltaBlock::~DeltaBlock()
 // class DeltaBlockCopy
 
 DeltaBlockCopy::DeltaBlockCopy(std::span<const uint8_t> data)
-	: block(data.size())
+	: DeltaBlock(data.size())
+	, block(data.size())
 {
 #ifdef DEBUG
 	sha1 = SHA1::calc(data);
@@ -272,6 +293,7 @@ DeltaBlockCopy::DeltaBlockCopy(std::span<const uint8_t> data)
 
 void DeltaBlockCopy::apply(std::span<uint8_t> dst) const
 {
+	std::scoped_lock lock(mutex);
 	if (compressed()) {
 		LZ4::decompress(block.data(), dst.data(), int(compressedSize), int(dst.size()));
 	} else {
@@ -282,26 +304,37 @@ void DeltaBlockCopy::apply(std::span<uint8_t> dst) const
 #endif
 }
 
-void DeltaBlockCopy::compress(size_t size)
+size_t DeltaBlockCopy::getMemoryUsage() const
+{
+	std::scoped_lock lock(mutex); // block may be replaced by compress()
+	return block.size();
+}
+
+void DeltaBlockCopy::compress()
 {
+	// Only this method changes 'block', so no need to lock yet. Concurrent
+	// apply() calls only read it.
 	if (compressed()) return;
 
-	size_t dstLen = LZ4::compressBound(int(size));
+	size_t dstLen = LZ4::compressBound(int(getSize()));
 	MemBuffer<uint8_t> buf2(dstLen);
-	dstLen = LZ4::compress(block.data(), buf2.data(), int(size));
+	dstLen = LZ4::compress(block.data(), buf2.data(), int(getSize()));
 
-	if (dstLen >= size) {
+	if (dstLen >= getSize()) {
 		// compression isn't beneficial
 		return;
 	}
-	compressedSize = dstLen;
-	std::swap(block, buf2);
-	block.resize(compressedSize); // shrink to fit
+	{
+		std::scoped_lock lock(mutex);
+		compressedSize = dstLen;
+		std::swap(block, buf2);
+		block.resize(compressedSize); // shrink to fit
+	}
 	assert(compressed());
 #ifdef DEBUG
-	MemBuffer<uint8_t> buf3(size);
-	apply({buf3.data(), size});
-	assert(std::ranges::equal(std::span{buf3.data(), size}, std::span{buf2.data(), size}));
+	MemBuffer<uint8_t> buf3(getSize());
+	apply({buf3.data(), getSize()});
+	assert(std::ranges::equal(std::span{buf3.data(), getSize()}, std::span{buf2.data(), getSize()}));
 #endif
 #if STATISTICS
 	int delta = compressedSize - allocSize;
@@ -319,13 +352,75 @@ const uint8_t* DeltaBlockCopy::getData()
 }
 
 
+// class DeltaBlockCompressor
+
+// Limit the number of blocks waiting to be compressed. When the worker can't
+// keep up, the emulation thread is slowed down instead of keeping more and
+// more uncompressed blocks around.
+static constexpr size_t MAX_QUEUED_BLOCKS = 8;
+
+DeltaBlockCompressor::~DeltaBlockCompressor()
+{
+	if (!thread.joinable()) return;
+	{
+		std::scoped_lock lock(mutex);
+		stop = true;
+	}
+	cond.notify_all();
+	thread.join();
+}
+
+void DeltaBlockCompressor::compress(const std::shared_ptr<DeltaBlockCopy>& block)
+{
+	if (!thread.joinable()) {
+		thread = std::thread([this] { workerMain(); });
+	}
+	{
+		std::unique_lock lock(mutex);
+		cond.wait(lock, [&] { return queue.size() < MAX_QUEUED_BLOCKS; });
+		queue.emplace_back(block);
+	}
+	cond.notify_all();
+}
+
+void DeltaBlockCompressor::sync()
+{
+	std::unique_lock lock(mutex);
+	cond.wait(lock, [&] { return queue.empty() && !busy; });
+}
+
+void DeltaBlockCompressor::workerMain()
+{
+	std::unique_lock lock(mutex);
+	while (true) {
+		cond.wait(lock, [&] { return stop || !queue.empty(); });
+		if (queue.empty()) return; // stop requested and all blocks done
+		auto weak = std::move(queue.front());
+		queue.pop_front();
+		busy = true;
+		lock.unlock();
+		cond.notify_all(); // there's room in the queue again
+
+		if (auto block = weak.lock()) {
+			block->compress();
+		}
+
+		lock.lock();
+		busy = false;
+		cond.notify_all(); // for sync()
+	}
+}
+
+
 // class DeltaBlockDiff
 
 DeltaBlockDiff::DeltaBlockDiff(
 		std::shared_ptr<DeltaBlockCopy> prev_,
-		std::span<const uint8_t> data)
-	: prev(std::move(prev_))
-	, delta(calcDelta(prev->getData(), data))
+		std::span<const uint8_t> data,
+		const DirtyPages* changed)
+	: DeltaBlock(data.size())
+	, prev(std::move(prev_))
+	, delta(calcDelta(prev->getData(), data, changed))
 {
 #ifdef DEBUG
 	sha1 = SHA1::calc(data);
@@ -351,6 +446,11 @@ void DeltaBlockDiff::apply(std::span<uint8_t> dst) const
 #endif
 }
 
+size_t DeltaBlockDiff::getMemoryUsage() const
+{
+	return delta.capacity();
+}
+
 size_t DeltaBlockDiff::getDeltaSize() const
 {
 	return delta.size();
@@ -359,10 +459,8 @@ size_t DeltaBlockDiff::getDeltaSize() const
 
 // class LastDeltaBlocks
 
-std::shared_ptr<DeltaBlock> LastDeltaBlocks::createNew(
-		const void* id, std::span<const uint8_t> data)
+LastDeltaBlocks::Info& LastDeltaBlocks::getInfo(const void* id, size_t size)
 {
-	auto size = data.size();
 	auto it = std::ranges::lower_bound(infos, std::tuple(id, size), {},
 		[](const Info& info) { return std::tuple(info.id, info.size); });
 	if ((it == end(infos)) || (it->id != id) || (it->size != size)) {
@@ -371,27 +469,61 @@ std::shared_ptr<DeltaBlock> LastDeltaBlocks::createNew(
 	}
 	assert(it->id   == id);
 	assert(it->size == size);
+	return *it;
+}
+
+std::shared_ptr<DeltaBlock> LastDeltaBlocks::createNew(
+		const void* id, std::span<const uint8_t> data)
+{
+	auto& info = getInfo(id, data.size());
+	// No information about what was written, compare everything.
+	info.changed.setAll();
+	return create(info, data);
+}
 
-	auto ref = it->ref.lock();
-	if (it->accSize >= size || !ref) {
+std::shared_ptr<DeltaBlock> LastDeltaBlocks::createNew(
+		const void* id, std::span<const uint8_t> data,
+		const DirtyPages& dirty)
+{
+	auto& info = getInfo(id, data.size());
+	if (!dirty.any()) {
+		if (auto last = info.last.lock()) {
+			// Nothing written since the previous block.
+#ifdef DEBUG
+			assert(SHA1::calc(data) == last->sha1);
+#endif
+			return last;
+		}
+	}
+	info.changed |= dirty;
+	return create(info, data);
+}
+
+std::shared_ptr<DeltaBlock> LastDeltaBlocks::create(
+		Info& info, std::span<const uint8_t> data)
+{
+	auto size = data.size();
+	auto ref = info.ref.lock();
+	if (info.accSize >= size || !ref) {
 		if (ref) {
 			// We will switch to a new DeltaBlockCopy object. So
 			// now is a good time to compress the old one.
-			ref->compress(size);
+			compressor.compress(ref);
 		}
 		// Heuristic: create a new block when too many small
 		// differences have accumulated.
 		auto b = std::make_shared<DeltaBlockCopy>(data);
-		it->ref = b;
-		it->last = b;
-		it->accSize = 0;
+		info.ref = b;
+		info.last = b;
+		info.accSize = 0;
+		info.changed.clear();
 		return b;
 	} else {
 		// Create diff based on earlier reference block.
 		// Reference remains unchanged.
-		auto b = std::make_shared<DeltaBlockDiff>(ref, data);
-		it->last = b;
-		it->accSize += b->getDeltaSize();
+		auto b = std::make_shared<DeltaBlockDiff>(ref, data, &info.changed);
+		info.last = b;
+		info.accSize += b->getDeltaSize();
 		return b;
 	}
 }
@@ -413,6 +545,7 @@ std::shared_ptr<DeltaBlock> LastDeltaBlocks::createNullDiff(
 		it->ref = b;
 		it->last = b;
 		it->accSize = 0;
+		it->changed.clear();
 		return b;
 	} else {
 #ifdef DEBUG
@@ -426,7 +559,7 @@ void LastDeltaBlocks::clear()
 {
 	for (const Info& info : infos) {
 		if (auto ref = info.ref.lock()) {
-			ref->compress(info.size);
+			compressor.compress(ref);
 		}
 	}
 	infos.clear();
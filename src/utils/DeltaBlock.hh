@@ -3,11 +3,17 @@
 
 #define STATISTICS 0
 
+#include "DirtyPages.hh"
 #include "MemBuffer.hh"
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 #ifdef DEBUG
 #include "sha1.hh"
@@ -25,8 +31,22 @@ public:
 #endif
 	virtual void apply(std::span<uint8_t> dst) const = 0;
 
+	/** The size of the (uncompressed) data block. */
+	[[nodiscard]] size_t getSize() const { return size; }
+
+	/** The number of bytes allocated by this block itself (so excluding
+	  * the block returned by getReference()).
+	  */
+	[[nodiscard]] virtual size_t getMemoryUsage() const = 0;
+
+	/** The block this one is stored relative to, or nullptr. */
+	[[nodiscard]] virtual const DeltaBlock* getReference() const { return nullptr; }
+
 protected:
-	DeltaBlock() = default;
+	explicit DeltaBlock(size_t size_) : size(size_) {}
+
+private:
+	size_t size;
 
 #ifdef DEBUG
 public:
@@ -46,7 +66,9 @@ class DeltaBlockCopy final : public DeltaBlock
 public:
 	explicit DeltaBlockCopy(std::span<const uint8_t> data);
 	void apply(std::span<uint8_t> dst) const override;
-	void compress(size_t size);
+	[[nodiscard]] size_t getMemoryUsage() const override;
+	// Can run on a different thread than apply().
+	void compress();
 	[[nodiscard]] const uint8_t* getData();
 
 private:
@@ -54,15 +76,59 @@ private:
 
 	MemBuffer<uint8_t> block;
 	size_t compressedSize = 0;
+	mutable std::mutex mutex; // protects the switch to the compressed block
+};
+
+
+/** Compresses DeltaBlockCopy objects on a background thread, so that this
+  * doesn't cause hiccups on the emulation thread. The thread is only
+  * started on first use. The queue is bounded: when it's full, compress()
+  * waits until there's room again.
+  */
+class DeltaBlockCompressor
+{
+public:
+	DeltaBlockCompressor() = default;
+	DeltaBlockCompressor(const DeltaBlockCompressor&) = delete;
+	DeltaBlockCompressor(DeltaBlockCompressor&&) = delete;
+	DeltaBlockCompressor& operator=(const DeltaBlockCompressor&) = delete;
+	DeltaBlockCompressor& operator=(DeltaBlockCompressor&&) = delete;
+	~DeltaBlockCompressor(); // finishes all queued work
+
+	/** Queue 'block' for compression. Nothing happens when the block got
+	  * deleted in the meantime.
+	  */
+	void compress(const std::shared_ptr<DeltaBlockCopy>& block);
+
+	/** Wait till all queued blocks are compressed. */
+	void sync();
+
+private:
+	void workerMain();
+
+private:
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+	std::deque<std::weak_ptr<DeltaBlockCopy>> queue;
+	bool busy = false; // worker is compressing a block
+	bool stop = false;
 };
 
 
 class DeltaBlockDiff final : public DeltaBlock
 {
 public:
+	/** Create the difference between 'prev_' and 'data'. When 'changed' is
+	  * given, only those pages are compared, all other pages must be
+	  * equal in both blocks.
+	  */
 	DeltaBlockDiff(std::shared_ptr<DeltaBlockCopy> prev_,
-	               std::span<const uint8_t> data);
+	               std::span<const uint8_t> data,
+	               const DirtyPages* changed = nullptr);
 	void apply(std::span<uint8_t> dst) const override;
+	[[nodiscard]] size_t getMemoryUsage() const override;
+	[[nodiscard]] const DeltaBlock* getReference() const override { return prev.get(); }
 	[[nodiscard]] size_t getDeltaSize() const;
 
 private:
@@ -76,23 +142,39 @@ class LastDeltaBlocks
 public:
 	[[nodiscard]] std::shared_ptr<DeltaBlock> createNew(
 		const void* id, std::span<const uint8_t> data);
+	/** Like above, but 'dirty' tells which pages of 'data' were (possibly)
+	  * written since the previous call for this block. Only those pages
+	  * are compared, when none are dirty the previous block is reused.
+	  */
+	[[nodiscard]] std::shared_ptr<DeltaBlock> createNew(
+		const void* id, std::span<const uint8_t> data,
+		const DirtyPages& dirty);
 	[[nodiscard]] std::shared_ptr<DeltaBlock> createNullDiff(
 		const void* id, std::span<const uint8_t> data);
 	void clear();
 
+	/** Wait till the old reference blocks are compressed. */
+	void sync() { compressor.sync(); }
+
 private:
 	struct Info {
 		Info(const void* id_, size_t size_)
-			: id(id_), size(size_) {}
+			: id(id_), size(size_), changed(size_) {}
 
 		const void* id;
 		size_t size;
 		std::weak_ptr<DeltaBlockCopy> ref;
 		std::weak_ptr<DeltaBlock> last;
 		size_t accSize = 0;
+		DirtyPages changed; // pages that (possibly) differ from 'ref'
 	};
 
+	[[nodiscard]] Info& getInfo(const void* id, size_t size);
+	[[nodiscard]] std::shared_ptr<DeltaBlock> create(
+		Info& info, std::span<const uint8_t> data);
+
 	std::vector<Info> infos;
+	DeltaBlockCompressor compressor;
 };
 
 } // namespace openmsx
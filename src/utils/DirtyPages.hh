@@ -0,0 +1,130 @@
+#ifndef DIRTYPAGES_HH
+#define DIRTYPAGES_HH
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace openmsx {
+
+/** Page-granular administration of which parts of a memory block have been
+  * written. It's used to remember the writes in between two reverse
+  * snapshots, so that the delta-compression (see DeltaBlock.hh) only has to
+  * look at the written pages.
+  *
+  * Initially (and after setAll()) all pages are marked dirty. Marking too
+  * much is always allowed (it only makes the next snapshot slower), but
+  * missing a write is not.
+  */
+class DirtyPages
+{
+public:
+	static constexpr unsigned PAGE_BITS = 8;
+	static constexpr size_t PAGE_SIZE = size_t(1) << PAGE_BITS;
+
+	/** Create an administration for a block of 'size' bytes.
+	  */
+	explicit DirtyPages(size_t size = 0) { resize(size); }
+
+	/** Change the size of the administration, all pages become dirty.
+	  */
+	void resize(size_t size)
+	{
+		numPages = (size + PAGE_SIZE - 1) >> PAGE_BITS;
+		words.resize((numPages + 63) / 64);
+		setAll();
+	}
+
+	/** Number of pages (not bytes). */
+	[[nodiscard]] size_t size() const { return numPages; }
+
+	/** Mark the page containing byte 'addr' as dirty.
+	  */
+	void set(size_t addr)
+	{
+		auto page = addr >> PAGE_BITS;
+		assert(page < numPages);
+		words[page / 64] |= uint64_t(1) << (page % 64);
+	}
+
+	/** Mark all pages that overlap with the 'num' bytes starting at byte
+	  * 'addr' as dirty.
+	  */
+	void set(size_t addr, size_t num)
+	{
+		if (num == 0) return;
+		auto last = (addr + num - 1) >> PAGE_BITS;
+		assert(last < numPages);
+		for (auto page = addr >> PAGE_BITS; page <= last; ++page) {
+			words[page / 64] |= uint64_t(1) << (page % 64);
+		}
+	}
+
+	void setAll()
+	{
+		std::ranges::fill(words, ~uint64_t(0));
+		if (auto rest = numPages % 64) {
+			words.back() = (uint64_t(1) << rest) - 1;
+		}
+	}
+
+	void clear()
+	{
+		std::ranges::fill(words, 0);
+	}
+
+	[[nodiscard]] bool test(size_t page) const
+	{
+		assert(page < numPages);
+		return words[page / 64] & (uint64_t(1) << (page % 64));
+	}
+
+	[[nodiscard]] bool any() const
+	{
+		return std::ranges::any_of(words, [](auto w) { return w != 0; });
+	}
+
+	/** Add the dirty pages of 'other'. That administration may cover a
+	  * larger block, its additional pages are ignored.
+	  */
+	DirtyPages& operator|=(const DirtyPages& other)
+	{
+		assert(other.numPages >= numPages);
+		for (size_t i = 0; i < words.size(); ++i) words[i] |= other.words[i];
+		if (auto rest = numPages % 64) {
+			words.back() &= (uint64_t(1) << rest) - 1;
+		}
+		return *this;
+	}
+
+	/** Call 'op(begin, end)' for each maximal run [begin, end) of dirty
+	  * pages, in increasing order.
+	  */
+	template<typename Op> void forEachRange(Op op) const
+	{
+		size_t page = 0;
+		while (page < numPages) {
+			// skip clean pages, a whole word at a time when possible
+			auto w = words[page / 64] >> (page % 64);
+			if (w == 0) {
+				page = (page / 64 + 1) * 64;
+				continue;
+			}
+			page += std::countr_zero(w);
+			auto begin = page;
+			while ((page < numPages) && test(page)) ++page;
+			op(begin, page);
+		}
+	}
+
+private:
+	std::vector<uint64_t> words;
+	size_t numPages = 0;
+};
+
+} // namespace openmsx
+
+#endif
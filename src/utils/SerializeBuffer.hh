@@ -186,7 +186,7 @@ public:
 	  */
 	void read(void* __restrict result, size_t len)
 	{
-		assert(buf.size() >= len);
+		checkSize(len);
 		memcpy(result, buf.data(), len);
 		buf = buf.subspan(len);
 	}
@@ -197,7 +197,7 @@ public:
 	  */
 	void skip(size_t len)
 	{
-		assert(buf.size() >= len);
+		checkSize(len);
 		buf = buf.subspan(len);
 	}
 
@@ -208,6 +208,15 @@ public:
 	  */
 	[[nodiscard]] const uint8_t* getCurrentPos() const { return buf.data(); }
 
+private:
+	// Normally the buffer was created by an OutputBuffer, but it can also
+	// come from a (possibly damaged) binary savestate file.
+	void checkSize(size_t len) const
+	{
+		if (buf.size() < len) [[unlikely]] throwEndOfData();
+	}
+	[[noreturn]] static void throwEndOfData();
+
 private:
 	std::span<const uint8_t> buf;
 };
@@ -7,6 +7,7 @@
 #include <array>
 #include <bit>
 #include <cstring>
+#include <optional>
 
 #ifdef _MSC_VER
 #  include <intrin.h>
@@ -690,4 +691,52 @@ safe_match_copy:
 	return int(op - dst); // Nb of output bytes decoded
 }
 
+int decompressSafe(const uint8_t* src, uint8_t* dst, int compressedSize, int dstCapacity)
+{
+	// Straightforward byte-oriented decoder that checks every access. Much
+	// slower than decompress(), but it never reads or writes out of bounds,
+	// not even for malformed input.
+	const uint8_t* ip = src;
+	const uint8_t* const iend = src + compressedSize;
+	uint8_t* op = dst;
+	uint8_t* const oend = dst + dstCapacity;
+
+	auto readLength = [&](size_t length) -> std::optional<size_t> {
+		if (length != ML_MASK) return length; // (ML_MASK == RUN_MASK)
+		unsigned s;
+		do {
+			if (ip == iend) return {};
+			s = *ip++;
+			length += s;
+		} while (s == 255);
+		return length;
+	};
+
+	while (true) {
+		if (ip == iend) return -1;
+		unsigned token = *ip++;
+
+		auto litLen = readLength(token >> ML_BITS);
+		if (!litLen || (*litLen > size_t(iend - ip)) || (*litLen > size_t(oend - op))) return -1;
+		memcpy(op, ip, *litLen);
+		ip += *litLen;
+		op += *litLen;
+		if (ip == iend) break; // last sequence has no match part
+
+		if ((iend - ip) < 2) return -1;
+		size_t offset = Endian::read_UA_L16(ip);
+		ip += 2;
+		if ((offset == 0) || (offset > size_t(op - dst))) return -1;
+
+		auto matchLen = readLength(token & ML_MASK);
+		if (!matchLen) return -1;
+		size_t length = *matchLen + MINMATCH;
+		if (length > size_t(oend - op)) return -1;
+		const uint8_t* match = op - offset;
+		for (size_t i = 0; i < length; ++i) op[i] = match[i]; // may overlap
+		op += length;
+	}
+	return int(op - dst);
+}
+
 } // namespace LZ4
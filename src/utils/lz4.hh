@@ -37,8 +37,10 @@
 //
 // The most important changes are:
 // - Stripped out all functions we don't use.
-// - Removed all safety checks. We only decompress data returned from the
-//   compress function, and that data is never stored/reloaded from disk.
+// - Removed all safety checks from decompress(). It's only used on data
+//   returned from the compress function that is never stored/reloaded from
+//   disk. Data that does get reloaded from disk (binary savestates, CPU
+//   traces) must go through decompressSafe(), a simple checked decoder.
 // - Rewrite in C++ style.
 // - Use existing openMSX helper functions.
 
@@ -55,6 +57,11 @@ namespace LZ4 {
 
 	[[nodiscard]] int compress(const uint8_t* src, uint8_t* dst, int srcSize);
 	int decompress(const uint8_t* src, uint8_t* dst, int compressedSize, int dstCapacity);
+
+	// Like decompress(), but safe to use on untrusted (e.g. loaded from
+	// disk) data. Returns the number of decompressed bytes, or -1 when the
+	// input is malformed or doesn't fit in 'dstCapacity' bytes.
+	[[nodiscard]] int decompressSafe(const uint8_t* src, uint8_t* dst, int compressedSize, int dstCapacity);
 }
 
 #endif
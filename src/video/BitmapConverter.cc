@@ -8,10 +8,57 @@
 
 #include <algorithm>
 #include <bit>
+#include <cassert>
+#include <cstring>
 #include <tuple>
 
+#ifdef __SSE2__
+#include "emmintrin.h" // SSE2
+// The AVX2 kernels are compiled for that target, independent of the flags
+// used for the rest of the build, and are only used when the CPU supports
+// them (checked at run-time).
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BITMAPCONVERTER_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#include "immintrin.h" // AVX2
+#endif
+#endif
+
 namespace openmsx {
 
+using Kernel = BitmapConverter::Kernel;
+using Pixel = BitmapConverter::Pixel;
+using DPixel = BitmapConverter::DPixel;
+
+static Kernel detectKernel()
+{
+#ifdef BITMAPCONVERTER_AVX2
+	if (__builtin_cpu_supports("avx2")) return Kernel::AVX2;
+#endif
+#ifdef __SSE2__
+	return Kernel::SSE2;
+#else
+	return Kernel::SCALAR;
+#endif
+}
+
+Kernel BitmapConverter::bestKernel()
+{
+	static const Kernel best = detectKernel();
+	return best;
+}
+
+bool BitmapConverter::isSupported(Kernel k)
+{
+	return k <= bestKernel();
+}
+
+void BitmapConverter::setKernel(Kernel k)
+{
+	assert(isSupported(k));
+	kernel = k;
+}
+
 BitmapConverter::BitmapConverter(
 		std::span<const Pixel, 256>    palette16_,
 		std::span<const Pixel, 16>     palette16odd_,
@@ -107,6 +154,203 @@ void BitmapConverter::convertLinePlanar(
 	}
 }
 
+#ifdef __SSE2__
+// Interleave 8 bytes from both planes: p0[0], p1[0], p0[1], p1[1], ...
+static inline __m128i interleavePlanes(const uint8_t* p0, const uint8_t* p1)
+{
+	__m128i d0 = _mm_loadl_epi64(std::bit_cast<const __m128i*>(p0));
+	__m128i d1 = _mm_loadl_epi64(std::bit_cast<const __m128i*>(p1));
+	return _mm_unpacklo_epi8(d0, d1);
+}
+
+// Calculate the palette32768 index for 8 pixels (2 groups of 4 YJK pixels).
+// 'q' contains the VRAM bytes (in display order), one per 16-bit lane.
+static inline __m128i yjkIndices(__m128i q)
+{
+	// Each group is one 64-bit lane. K is stored in the lower 3 bits of
+	// the 1st and 2nd byte, J in the 3rd and 4th byte, both are 6-bit
+	// signed values.
+	const __m128i m07 = _mm_set1_epi64x(0x07);
+	const __m128i m38 = _mm_set1_epi64x(0x38);
+	const __m128i m20 = _mm_set1_epi64x(0x20);
+	__m128i k = _mm_or_si128(_mm_and_si128(q, m07),
+	                         _mm_and_si128(_mm_srli_epi64(q, 16 - 3), m38));
+	__m128i j = _mm_or_si128(_mm_and_si128(_mm_srli_epi64(q, 32), m07),
+	                         _mm_and_si128(_mm_srli_epi64(q, 48 - 3), m38));
+	k = _mm_sub_epi64(_mm_xor_si128(k, m20), m20); // sign extend
+	j = _mm_sub_epi64(_mm_xor_si128(j, m20), m20);
+	// broadcast to all 4 pixels in the group
+	k = _mm_shufflehi_epi16(_mm_shufflelo_epi16(k, 0), 0);
+	j = _mm_shufflehi_epi16(_mm_shufflelo_epi16(j, 0), 0);
+
+	// Same calculation as yjk2rgb(). For 'blue' an arithmetic shift rounds
+	// towards minus infinity instead of towards zero, but that only makes
+	// a difference for negative values, which get clamped to 0 anyway.
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i m31 = _mm_set1_epi16(31);
+	auto clamp = [&](__m128i x) {
+		return _mm_min_epi16(_mm_max_epi16(x, zero), m31);
+	};
+	__m128i y = _mm_srli_epi16(q, 3);
+	__m128i r = clamp(_mm_add_epi16(y, j));
+	__m128i g = clamp(_mm_add_epi16(y, k));
+	__m128i b5 = _mm_add_epi16(_mm_slli_epi16(y, 2), y);
+	__m128i b = _mm_sub_epi16(_mm_sub_epi16(b5, _mm_add_epi16(j, j)), k);
+	b = clamp(_mm_srai_epi16(_mm_add_epi16(b, _mm_set1_epi16(2)), 2));
+	return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 10),
+	                                 _mm_slli_epi16(g, 5)),
+	                    b);
+}
+
+static void yjkSSE2(Pixel* __restrict pixelPtr,
+                    const uint8_t* vramPtr0, const uint8_t* vramPtr1,
+                    const Pixel* palette32768)
+{
+	// 16 pixels per iteration, handled as 2 halves of 8 pixels
+	const __m128i zero = _mm_setzero_si128();
+	for (unsigned i = 0; i < 128; i += 8) {
+		__m128i data = interleavePlanes(&vramPtr0[i], &vramPtr1[i]);
+		for (int h : {0, 1}) {
+			__m128i q = h ? _mm_unpackhi_epi8(data, zero)
+			              : _mm_unpacklo_epi8(data, zero);
+			alignas(16) std::array<uint16_t, 8> col;
+			_mm_store_si128(std::bit_cast<__m128i*>(col.data()), yjkIndices(q));
+			Pixel* out = &pixelPtr[2 * i + 8 * h];
+			for (auto n : xrange(8)) out[n] = palette32768[col[n]];
+		}
+	}
+}
+
+static void yaeSSE2(Pixel* __restrict pixelPtr,
+                    const uint8_t* vramPtr0, const uint8_t* vramPtr1,
+                    const Pixel* palette16, const Pixel* palette32768)
+{
+	// 16 pixels per iteration, handled as 2 halves of 8 pixels
+	const __m128i zero = _mm_setzero_si128();
+	for (unsigned i = 0; i < 128; i += 8) {
+		__m128i data = interleavePlanes(&vramPtr0[i], &vramPtr1[i]);
+		for (int h : {0, 1}) {
+			__m128i q = h ? _mm_unpackhi_epi8(data, zero)
+			              : _mm_unpacklo_epi8(data, zero);
+			alignas(16) std::array<uint16_t, 8> col;
+			alignas(16) std::array<uint16_t, 8> p;
+			_mm_store_si128(std::bit_cast<__m128i*>(col.data()), yjkIndices(q));
+			_mm_store_si128(std::bit_cast<__m128i*>(p.data()), q);
+			Pixel* out = &pixelPtr[2 * i + 8 * h];
+			for (auto n : xrange(8)) {
+				out[n] = (p[n] & 0x08) ? palette16[p[n] >> 4]
+				                       : palette32768[col[n]];
+			}
+		}
+	}
+}
+#endif
+
+#ifdef BITMAPCONVERTER_AVX2
+// Note: no lambdas in these functions, they wouldn't inherit the target.
+
+AVX2_TARGET static void graphic4AVX2(Pixel* __restrict pixelPtr,
+                                     const uint8_t* vramPtr0, const DPixel* dPalette)
+{
+	// 8 pixels per iteration, lookup 4 double-pixels with one gather
+	const auto* dPal = std::bit_cast<const long long*>(dPalette);
+	for (unsigned i = 0; i < 128; i += 4) {
+		uint32_t data;
+		memcpy(&data, &vramPtr0[i], sizeof(data));
+		__m128i idx = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(int(data)));
+		_mm256_storeu_si256(std::bit_cast<__m256i*>(&pixelPtr[2 * i]),
+		                    _mm256_i32gather_epi64(dPal, idx, 8));
+	}
+}
+
+AVX2_TARGET static inline void gatherDPixels(Pixel* out, const long long* dPal, __m128i idx)
+{
+	_mm256_storeu_si256(std::bit_cast<__m256i*>(out),
+	                    _mm256_i32gather_epi64(dPal, idx, 8));
+}
+
+AVX2_TARGET static void graphic6AVX2(Pixel* __restrict pixelPtr,
+                                     const uint8_t* vramPtr0, const uint8_t* vramPtr1,
+                                     const DPixel* dPalette)
+{
+	// 32 pixels per iteration
+	const auto* dPal = std::bit_cast<const long long*>(dPalette);
+	for (unsigned i = 0; i < 128; i += 8) {
+		__m128i data = interleavePlanes(&vramPtr0[i], &vramPtr1[i]);
+		__m256i lo = _mm256_cvtepu8_epi32(data);
+		__m256i hi = _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(data, data));
+		Pixel* out = &pixelPtr[4 * i];
+		gatherDPixels(out +  0, dPal, _mm256_castsi256_si128(lo));
+		gatherDPixels(out +  8, dPal, _mm256_extracti128_si256(lo, 1));
+		gatherDPixels(out + 16, dPal, _mm256_castsi256_si128(hi));
+		gatherDPixels(out + 24, dPal, _mm256_extracti128_si256(hi, 1));
+	}
+}
+
+AVX2_TARGET static void graphic7AVX2(Pixel* __restrict pixelPtr,
+                                     const uint8_t* vramPtr0, const uint8_t* vramPtr1,
+                                     const Pixel* palette)
+{
+	// 16 pixels per iteration
+	const auto* pal = std::bit_cast<const int*>(palette);
+	for (unsigned i = 0; i < 128; i += 8) {
+		__m128i data = interleavePlanes(&vramPtr0[i], &vramPtr1[i]);
+		__m256i lo = _mm256_cvtepu8_epi32(data);
+		__m256i hi = _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(data, data));
+		_mm256_storeu_si256(std::bit_cast<__m256i*>(&pixelPtr[2 * i + 0]),
+		                    _mm256_i32gather_epi32(pal, lo, 4));
+		_mm256_storeu_si256(std::bit_cast<__m256i*>(&pixelPtr[2 * i + 8]),
+		                    _mm256_i32gather_epi32(pal, hi, 4));
+	}
+}
+
+AVX2_TARGET static void yjkAVX2(Pixel* __restrict pixelPtr,
+                                const uint8_t* vramPtr0, const uint8_t* vramPtr1,
+                                const Pixel* palette32768)
+{
+	// 16 pixels per iteration, handled as 2 halves of 8 pixels
+	const auto* pal = std::bit_cast<const int*>(palette32768);
+	const __m128i zero = _mm_setzero_si128();
+	for (unsigned i = 0; i < 128; i += 8) {
+		__m128i data = interleavePlanes(&vramPtr0[i], &vramPtr1[i]);
+		for (int h : {0, 1}) {
+			__m128i q = h ? _mm_unpackhi_epi8(data, zero)
+			              : _mm_unpacklo_epi8(data, zero);
+			__m128i idx = yjkIndices(q);
+			_mm256_storeu_si256(std::bit_cast<__m256i*>(&pixelPtr[2 * i + 8 * h]),
+				_mm256_i32gather_epi32(pal, _mm256_cvtepu16_epi32(idx), 4));
+		}
+	}
+}
+
+AVX2_TARGET static void yaeAVX2(Pixel* __restrict pixelPtr,
+                                const uint8_t* vramPtr0, const uint8_t* vramPtr1,
+                                const Pixel* palette16, const Pixel* palette32768)
+{
+	// 16 pixels per iteration, handled as 2 halves of 8 pixels
+	const auto* pal16    = std::bit_cast<const int*>(palette16);
+	const auto* pal32768 = std::bit_cast<const int*>(palette32768);
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i m08 = _mm_set1_epi16(0x08);
+	for (unsigned i = 0; i < 128; i += 8) {
+		__m128i data = interleavePlanes(&vramPtr0[i], &vramPtr1[i]);
+		for (int h : {0, 1}) {
+			__m128i q = h ? _mm_unpackhi_epi8(data, zero)
+			              : _mm_unpacklo_epi8(data, zero);
+			__m128i idx = yjkIndices(q);
+			// first all pixels as YJK, then overwrite the YAE pixels
+			__m256i pix = _mm256_i32gather_epi32(
+				pal32768, _mm256_cvtepu16_epi32(idx), 4);
+			__m128i yae = _mm_cmpeq_epi16(_mm_and_si128(q, m08), m08);
+			pix = _mm256_mask_i32gather_epi32(
+				pix, pal16, _mm256_cvtepu16_epi32(_mm_srli_epi16(q, 4)),
+				_mm256_cvtepi16_epi32(yae), 4);
+			_mm256_storeu_si256(std::bit_cast<__m256i*>(&pixelPtr[2 * i + 8 * h]), pix);
+		}
+	}
+}
+#endif
+
 void BitmapConverter::renderGraphic4(
 	std::span<Pixel, 256> buf,
 	std::span<const uint8_t, 128> vramPtr0)
@@ -125,6 +369,12 @@ void BitmapConverter::renderGraphic4(
 	}
 
 	Pixel* __restrict pixelPtr = buf.data();
+#ifdef BITMAPCONVERTER_AVX2
+	if (kernel == Kernel::AVX2) {
+		graphic4AVX2(pixelPtr, vramPtr0.data(), dPalette.data());
+		return;
+	}
+#endif
 	      auto* out = std::bit_cast<DPixel*>(pixelPtr);
 	const auto* in  = std::bit_cast<const unsigned*>(vramPtr0.data());
 	for (auto i : xrange(256 / 8)) {
@@ -175,6 +425,12 @@ void BitmapConverter::renderGraphic6(
 	if (!dPaletteValid) [[unlikely]] {
 		calcDPalette();
 	}
+#ifdef BITMAPCONVERTER_AVX2
+	if (kernel == Kernel::AVX2) {
+		graphic6AVX2(pixelPtr, vramPtr0.data(), vramPtr1.data(), dPalette.data());
+		return;
+	}
+#endif
 	      auto* out = std::bit_cast<DPixel*>(pixelPtr);
 	const auto* in0 = std::bit_cast<const unsigned*>(vramPtr0.data());
 	const auto* in1 = std::bit_cast<const unsigned*>(vramPtr1.data());
@@ -210,6 +466,13 @@ void BitmapConverter::renderGraphic7(
 	std::span<const uint8_t, 128> vramPtr1) const
 {
 	Pixel* __restrict pixelPtr = buf.data();
+#ifdef BITMAPCONVERTER_AVX2
+	if (kernel == Kernel::AVX2) {
+		graphic7AVX2(pixelPtr, vramPtr0.data(), vramPtr1.data(),
+		             enableEPAL ? palette16.data() : palette256.data());
+		return;
+	}
+#endif
 	if (enableEPAL) {
 		for (auto i : xrange(128)) {
 			pixelPtr[2 * i + 0] = palette16[vramPtr0[i]];
@@ -242,6 +505,18 @@ void BitmapConverter::renderYJK(
 	std::span<const uint8_t, 128> vramPtr1) const
 {
 	Pixel* __restrict pixelPtr = buf.data();
+#ifdef BITMAPCONVERTER_AVX2
+	if (kernel == Kernel::AVX2) {
+		yjkAVX2(pixelPtr, vramPtr0.data(), vramPtr1.data(), palette32768.data());
+		return;
+	}
+#endif
+#ifdef __SSE2__
+	if (kernel == Kernel::SSE2) {
+		yjkSSE2(pixelPtr, vramPtr0.data(), vramPtr1.data(), palette32768.data());
+		return;
+	}
+#endif
 	for (auto i : xrange(64)) {
 		std::array<unsigned, 4> p = {
 			vramPtr0[2 * i + 0],
@@ -267,6 +542,20 @@ void BitmapConverter::renderYAE(
 	std::span<const uint8_t, 128> vramPtr1) const
 {
 	Pixel* __restrict pixelPtr = buf.data();
+#ifdef BITMAPCONVERTER_AVX2
+	if (kernel == Kernel::AVX2) {
+		yaeAVX2(pixelPtr, vramPtr0.data(), vramPtr1.data(),
+		        palette16.data(), palette32768.data());
+		return;
+	}
+#endif
+#ifdef __SSE2__
+	if (kernel == Kernel::SSE2) {
+		yaeSSE2(pixelPtr, vramPtr0.data(), vramPtr1.data(),
+		        palette16.data(), palette32768.data());
+		return;
+	}
+#endif
 	for (auto i : xrange(64)) {
 		std::array<unsigned, 4> p = {
 			vramPtr0[2 * i + 0],
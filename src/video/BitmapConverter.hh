@@ -17,6 +17,13 @@ public:
 	using Pixel = uint32_t;
 	using DPixel = uint64_t;
 
+	/** The implementations of the inner loops. SSE2 is the baseline on
+	  * x86, the AVX2 kernels are always compiled in (on x86 with gcc or
+	  * clang) and are selected at run-time when the CPU supports them.
+	  * Modes without an SSE2 kernel fall back to the SCALAR one.
+	  */
+	enum class Kernel : uint8_t { SCALAR, SSE2, AVX2 };
+
 	/** Create a new bitmap scanline converter.
 	  * @param palette16 Pointer to 2*16-entries array that specifies
 	  *   VDP color index to host pixel mapping.
@@ -81,11 +88,33 @@ public:
 		dPaletteValid = false;
 	}
 
+	/** Update the state that's normally calculated on demand. Afterwards
+	  * (until the palette changes) the convertLine methods can be called
+	  * concurrently from several threads.
+	  */
+	void prepare()
+	{
+		if (!dPaletteValid) calcDPalette();
+	}
+
 	void setEPAL(bool enable)
 	{
 		enableEPAL = enable;
 	}
 
+	/** Is the given kernel compiled in and supported by this CPU? */
+	[[nodiscard]] static bool isSupported(Kernel k);
+
+	/** The fastest supported kernel, only detected once. This is the
+	  * default for new BitmapConverter objects.
+	  */
+	[[nodiscard]] static Kernel bestKernel();
+
+	/** Select a different (supported) kernel. All kernels produce
+	  * identical output, this is only meant for testing.
+	  */
+	void setKernel(Kernel k);
+
 private:
 	void calcDPalette();
 
@@ -117,6 +146,7 @@ private:
 	DisplayMode mode;
 	bool dPaletteValid = false;
 	bool enableEPAL = false;
+	Kernel kernel = bestKernel();
 };
 
 } // namespace openmsx
@@ -17,6 +17,7 @@
 #include "FileContext.hh"
 #include "FileOperations.hh"
 #include "HardwareConfig.hh"
+#include "HostTimeProfile.hh"
 #include "IntegerSetting.hh"
 #include "MSXMotherBoard.hh"
 #include "Reactor.hh"
@@ -373,6 +374,7 @@ void Display::repaint()
 {
 	// Request a repaint from the VideoSystem. This may call repaintImpl()
 	// directly or for example defer to a signal callback on VisibleSurface.
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::VDP_RENDER);
 	videoSystem->repaint();
 }
 
@@ -18,6 +18,7 @@ TODO:
 #include "Event.hh"
 #include "EventDistributor.hh"
 #include "GlobalSettings.hh"
+#include "HostTimeProfile.hh"
 #include "IntegerSetting.hh"
 #include "MSXMotherBoard.hh"
 #include "Reactor.hh"
@@ -29,6 +30,7 @@ TODO:
 #include "narrow.hh"
 #include "one_of.hh"
 #include "unreachable.hh"
+#include "xrange.hh"
 
 #include <algorithm>
 #include <cassert>
@@ -37,7 +39,8 @@ TODO:
 namespace openmsx {
 
 void PixelRenderer::draw(
-	int startX, int startY, int endX, int endY, DrawType drawType, bool atEnd)
+	int startX, int startY, int endX, int endY, DrawType drawType,
+	bool atEnd, bool fullLines)
 {
 	if (drawType == DRAW_BORDER) {
 		rasterizer->drawBorder(startX, startY, endX, endY);
@@ -63,22 +66,40 @@ void PixelRenderer::draw(
 
 		displayY &= 255; // Page wrap.
 		int displayWidth = (endX - (startX & ~1)) / VDP::TICKS_DIV_DHCLK;
-		int displayHeight = endY - startY;
 
 		assert(0 <= displayX);
 		assert(displayX + displayWidth <= 512);
 
-		rasterizer->drawDisplay(
-			startX, startY,
-			displayX - vdp.getHorizontalScrollLow() * 2, displayY,
-			displayWidth, displayHeight
-			);
-		if (vdp.spritesEnabled() && !renderSettings.getDisableSprites()) {
-			rasterizer->drawSprites(
-				startX, startY,
-				displayX / 2, displayY,
-				(displayWidth + 1) / 2, displayHeight);
+		auto drawLines = [&](int fromY, int limitY) {
+			if (fromY == limitY) return;
+			int lineY = (displayY + fromY - startY) & 255;
+			rasterizer->drawDisplay(
+				startX, fromY,
+				displayX - vdp.getHorizontalScrollLow() * 2, lineY,
+				displayWidth, limitY - fromY
+				);
+			if (vdp.spritesEnabled() && !renderSettings.getDisableSprites()) {
+				rasterizer->drawSprites(
+					startX, fromY,
+					displayX / 2, lineY,
+					(displayWidth + 1) / 2, limitY - fromY);
+			}
+		};
+
+		// Copy the lines that didn't change since the previous frame,
+		// render the others.
+		int reuseY0 = endY;
+		int reuseY1 = endY;
+		if (fullLines) {
+			int y0 = std::clamp(reuseFromY, startY, endY);
+			int y1 = std::clamp(changeMinY, y0, endY);
+			if ((y0 != y1) && rasterizer->reuseLines(y0, y1)) {
+				reuseY0 = y0;
+				reuseY1 = y1;
+			}
 		}
+		drawLines(startY, reuseY0);
+		drawLines(reuseY1, endY);
 	}
 }
 
@@ -91,7 +112,7 @@ void PixelRenderer::subdivide(
 		bool atEnd = (startY != endY) || (endX >= clipR);
 		if (startX < clipR) {
 			draw(startX, startY, (atEnd ? clipR : endX),
-			     startY + 1, drawType, atEnd);
+			     startY + 1, drawType, atEnd, false);
 		}
 		if (startY == endY) return;
 		startY++;
@@ -105,13 +126,13 @@ void PixelRenderer::subdivide(
 	}
 	// Full middle lines.
 	if (startY < endY) {
-		draw(clipL, startY, clipR, endY, drawType, true);
+		draw(clipL, startY, clipR, endY, drawType, true, true);
 	}
 	// Actually draw last line if necessary.
 	// The point of keeping top-to-bottom draw order is that it increases
 	// the locality of memory references, which generally improves cache
 	// hit rates.
-	if (drawLast) draw(clipL, endY, endX, endY + 1, drawType, false);
+	if (drawLast) draw(clipL, endY, endX, endY + 1, drawType, false, false);
 }
 
 PixelRenderer::PixelRenderer(VDP& vdp_, Display& display)
@@ -135,10 +156,12 @@ PixelRenderer::PixelRenderer(VDP& vdp_, Display& display)
 
 	renderSettings.getMaxFrameSkipSetting().attach(*this);
 	renderSettings.getMinFrameSkipSetting().attach(*this);
+	renderSettings.getDisableSpritesSetting().attach(*this);
 }
 
 PixelRenderer::~PixelRenderer()
 {
+	renderSettings.getDisableSpritesSetting().detach(*this);
 	renderSettings.getMinFrameSkipSetting().detach(*this);
 	renderSettings.getMaxFrameSkipSetting().detach(*this);
 }
@@ -155,6 +178,8 @@ void PixelRenderer::reInit()
 	// renderer in the middle of a frame.
 	renderFrame = false;
 	paintFrame = false;
+	prevFrameComplete = false;
+	vramChangedWhileDisabled = false;
 
 	rasterizer->reset();
 	displayEnabled = vdp.isDisplayEnabled();
@@ -163,6 +188,10 @@ void PixelRenderer::reInit()
 void PixelRenderer::updateDisplayEnabled(bool enabled, EmuTime time)
 {
 	sync(time, true);
+	if (enabled && vramChangedWhileDisabled) {
+		vramChangedWhileDisabled = false;
+		markChange(time);
+	}
 	displayEnabled = enabled;
 }
 
@@ -173,6 +202,7 @@ void PixelRenderer::frameStart(EmuTime time)
 		renderFrame = false;
 		prevRenderFrame = false;
 		paintFrame = false;
+		prevFrameComplete = false;
 		return;
 	}
 
@@ -213,6 +243,18 @@ void PixelRenderer::frameStart(EmuTime time)
 
 	accuracy = renderSettings.getAccuracy();
 
+	// Lines below the last change in the previous rendered frame were
+	// rendered with the current state, so they can be reused as long as
+	// nothing changes in this frame.
+	bool changedRegs = checkRegisters(); // always update the snapshot
+	bool reusable = prevFrameComplete && !changedWhileSkipped &&
+	                !changedRegs && isReusableFrame();
+	reuseFromY = reusable ? changeMaxY + 1 : std::numeric_limits<int>::max();
+	changeMinY = std::numeric_limits<int>::max();
+	changeMaxY = -1;
+	changedWhileSkipped = false;
+	prevFrameComplete = false;
+
 	nextX = 0;
 	nextY = 0;
 	// This is not what the real VDP does, but it is good enough
@@ -222,6 +264,7 @@ void PixelRenderer::frameStart(EmuTime time)
 
 void PixelRenderer::frameEnd(EmuTime time)
 {
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::VDP_RENDER);
 	if (renderFrame) {
 		// Render changes from this last frame.
 		sync(time, true);
@@ -244,6 +287,7 @@ void PixelRenderer::frameEnd(EmuTime time)
 		if (paintFrame) {
 			lastPaintTime = time2;
 		}
+		prevFrameComplete = true;
 	}
 	if (vdp.getMotherBoard().isActive() &&
 	    !vdp.getMotherBoard().isFastForwarding()) {
@@ -291,6 +335,7 @@ void PixelRenderer::updateSuperimposing(
 	const RawFrame* videoSource, EmuTime time)
 {
 	if (displayEnabled) sync(time);
+	markChange(time);
 	rasterizer->setSuperimposeVideoFrame(videoSource);
 }
 
@@ -320,13 +365,14 @@ void PixelRenderer::updateBlinkBackgroundColor(
 }
 
 void PixelRenderer::updateBlinkState(
-	bool /*enabled*/, EmuTime /*time*/)
+	bool /*enabled*/, EmuTime time)
 {
 	// TODO: When the sync call is enabled, the screen flashes on
 	//       every call to this method.
 	//       I don't know why exactly, but it's probably related to
 	//       being called at frame start.
 	//sync(time);
+	markChange(time);
 }
 
 void PixelRenderer::updatePalette(
@@ -348,6 +394,7 @@ void PixelRenderer::updatePalette(
 			}
 		}
 	}
+	markChange(time);
 	rasterizer->setPalette(index, grb);
 }
 
@@ -518,6 +565,100 @@ void PixelRenderer::updateVRAM(unsigned offset, EmuTime time)
 	if (renderFrame && displayEnabled && checkSync(offset, time)) {
 		renderUntil(time);
 	}
+	// Even if the current output doesn't change, this may prevent reusing
+	// lines later on.
+	if ((renderFrame || !changedWhileSkipped) && affectsDisplay(offset)) {
+		if (displayEnabled) {
+			markChange(time);
+		} else {
+			vramChangedWhileDisabled = true;
+		}
+	}
+}
+
+bool PixelRenderer::isObserving(unsigned first, unsigned last) const
+{
+	// Like checkSync(), but for a range of addresses and independent of
+	// the current beam position.
+	// When display is disabled, VRAM changes don't affect the current
+	// output, but the first one still needs to be tracked for reusing
+	// lines (see updateVRAM()).
+	if (!displayEnabled && vramChangedWhileDisabled) return false;
+	return isVisible(first, last);
+}
+
+bool PixelRenderer::isVisible(unsigned first, unsigned last) const
+{
+	switch (vdp.getDisplayMode().getBase()) {
+	case DisplayMode::GRAPHIC4:
+	case DisplayMode::GRAPHIC5: {
+		if (vdp.isFastBlinkEnabled()) return true;
+		unsigned visiblePage = vram.nameTable.getMask()
+			& (0x10000 | (vdp.getEvenOddMask() << 7));
+		for (unsigned page = first >> 15; page <= (last >> 15); ++page) {
+			unsigned offset = (page << 15) & 0x18000;
+			if ((offset == visiblePage) ||
+			    (vdp.isMultiPageScrolling() &&
+			     (offset == (visiblePage & 0x10000)))) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true; // TODO: Implement better detection.
+	}
+}
+
+bool PixelRenderer::affectsDisplay(unsigned offset) const
+{
+	if (vram.spriteAttribTable.isInside(offset) ||
+	    vram.spritePatternTable.isInside(offset)) {
+		return true;
+	}
+	if (vdp.getDisplayMode().isBitmapMode()) {
+		return isVisible(offset, offset);
+	}
+	return vram.nameTable.isInside(offset)
+		|| vram.colorTable.isInside(offset)
+		|| vram.patternTable.isInside(offset);
+}
+
+void PixelRenderer::markChange(EmuTime time)
+{
+	if (renderFrame) {
+		int beamY = vdp.getTicksThisFrame(time) / VDP::TICKS_PER_LINE;
+		changeMinY = std::min(changeMinY, nextY);
+		changeMaxY = std::max({changeMaxY, nextY, beamY});
+	} else {
+		changedWhileSkipped = true;
+	}
+}
+
+bool PixelRenderer::checkRegisters()
+{
+	// Registers that don't influence the rendered image: VRAM bank,
+	// status register pointer, palette pointer, indirect register pointer
+	// and interrupt line.
+	static constexpr uint32_t IGNORED =
+		(1 << 14) | (1 << 15) | (1 << 16) | (1 << 17) | (1 << 19);
+
+	auto regs = vdp.getControlRegs();
+	for (auto i : xrange(regs.size())) {
+		if (IGNORED & (1 << i)) regs[i] = 0;
+	}
+	if (regs == renderedRegs) return false;
+	renderedRegs = regs;
+	return true;
+}
+
+bool PixelRenderer::isReusableFrame() const
+{
+	// The output of these frames also depends on the frame number or on
+	// an external video source.
+	return !vdp.isInterlaced() && !vdp.isEvenOddEnabled()
+	    && !vdp.isFastBlinkEnabled() && !vdp.isFIL()
+	    && !vdp.isSuperimposing();
 }
 
 void PixelRenderer::updateWindow(bool /*enabled*/, EmuTime /*time*/)
@@ -552,6 +693,7 @@ void PixelRenderer::sync(EmuTime time, bool force)
 
 void PixelRenderer::renderUntil(EmuTime time)
 {
+	HostTimeProfile::Scope profile(HostTimeProfile::Category::VDP_RENDER);
 	// Translate from time to pixel position.
 	int limitTicks = vdp.getTicksThisFrame(time);
 	assert(limitTicks <= vdp.getTicksPerFrame());
@@ -581,6 +723,10 @@ void PixelRenderer::renderUntil(EmuTime time)
 	// Also it is a small performance optimisation.
 	if (limitX == nextX && limitY == nextY) return;
 
+	// Register changes the renderer isn't explicitly notified about (e.g.
+	// sprite size or the number of lines) also influence the output.
+	if (checkRegisters()) markChange(time);
+
 	if (displayEnabled) {
 		if (vdp.spritesEnabled()) {
 			// Update sprite checking, so that rasterizer can call getSprites.
@@ -620,9 +766,14 @@ void PixelRenderer::renderUntil(EmuTime time)
 
 void PixelRenderer::update(const Setting& setting) noexcept
 {
+	if (&setting == &renderSettings.getDisableSpritesSetting()) {
+		// Lines of the previous frame might have the wrong sprites.
+		reuseFromY = std::numeric_limits<int>::max();
+		prevFrameComplete = false;
+		return;
+	}
 	assert(&setting == one_of(&renderSettings.getMinFrameSkipSetting(),
 	                          &renderSettings.getMaxFrameSkipSetting()));
-	(void)setting;
 	// Force drawing of frame.
 	frameSkipCounter = 999;
 }
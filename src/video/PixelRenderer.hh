@@ -6,7 +6,9 @@
 
 #include "Observer.hh"
 
+#include <array>
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 namespace openmsx {
@@ -60,6 +62,7 @@ public:
 	void updateSpritesEnabled(bool enabled, EmuTime time) override;
 	void updateVRAM(unsigned offset, EmuTime time) override;
 	void updateWindow(bool enabled, EmuTime time) override;
+	[[nodiscard]] bool isObserving(unsigned first, unsigned last) const override;
 
 private:
 	/** Indicates whether the area to be drawn is border or display. */
@@ -70,10 +73,12 @@ private:
 
 	/** Call the right draw method in the subclass,
 	  * depending on passed drawType.
+	  * @param fullLines True iff the area consists of complete lines,
+	  *     only then lines can be reused from the previous frame.
 	  */
 	void draw(
 		int startX, int startY, int endX, int endY, DrawType drawType,
-		bool atEnd);
+		bool atEnd, bool fullLines);
 
 	/** Subdivide an area specified by two scan positions into a series of
 	  * rectangles.
@@ -88,6 +93,34 @@ private:
 
 	[[nodiscard]] bool checkSync(unsigned offset, EmuTime time) const;
 
+	/** Might a change in the given VRAM range influence the rendered
+	  * image? Independent of the beam position and of display enable.
+	  */
+	[[nodiscard]] bool isVisible(unsigned first, unsigned last) const;
+
+	/** Like isVisible(), but for a single address and more precise for the
+	  * character based display modes.
+	  */
+	[[nodiscard]] bool affectsDisplay(unsigned offset) const;
+
+	/** Something that influences the rendered image changed.
+	  * Lines from nextY on are rendered with the new state. But the sprite
+	  * checker already checked the sprites up to the current beam
+	  * position, so lines up to there can still show the old state.
+	  * @param time The moment of the change.
+	  */
+	void markChange(EmuTime time);
+
+	/** Did any of the control registers that influence the rendered image
+	  * change since the previous call?
+	  */
+	[[nodiscard]] bool checkRegisters();
+
+	/** Can lines of the current frame (in principle) be reused in the next
+	  * frame?
+	  */
+	[[nodiscard]] bool isReusableFrame() const;
+
 	/** Update renderer state to specified moment in time.
 	  * @param time Moment in emulated time to update to.
 	  * @param force When screen accuracy is used,
@@ -141,6 +174,32 @@ private:
 	// internal VDP counter, actually belongs in VDP
 	int textModeCounter;
 
+	/** Lines [reuseFromY, changeMinY) of the current frame look the same
+	  * as in the previous rendered frame, so they can be copied from that
+	  * frame. reuseFromY is just below the last change of that frame.
+	  */
+	int reuseFromY = std::numeric_limits<int>::max();
+	int changeMinY = std::numeric_limits<int>::max();
+	int changeMaxY = -1;
+
+	/** Did something change while frames were skipped?
+	  */
+	bool changedWhileSkipped = true;
+
+	/** Did VRAM change while display was disabled? All such changes have
+	  * the same effect, so they're only marked when display is enabled.
+	  */
+	bool vramChangedWhileDisabled = false;
+
+	/** Is the previous rendered frame complete and rendered with the
+	  * current settings?
+	  */
+	bool prevFrameComplete = false;
+
+	/** Values of the control registers, see checkRegisters().
+	  */
+	std::array<uint8_t, 32> renderedRegs = {};
+
 	/** Accuracy setting for current frame.
 	  */
 	RenderSettings::Accuracy accuracy;
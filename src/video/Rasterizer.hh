@@ -101,6 +101,17 @@ public:
 		int displayX, int displayY,
 		int displayWidth, int displayHeight) = 0;
 
+	/** Copy complete lines from the previously rendered frame instead of
+	  * rendering them again. The caller guarantees that nothing that
+	  * influences the output of these lines changed since they were
+	  * rendered in that frame.
+	  * @param fromY Y coordinate of the first line to copy (inclusive).
+	  * @param limitY Y coordinate of the last line to copy (exclusive).
+	  * @return False iff the lines could not be copied, in that case the
+	  *         caller must draw them instead.
+	  */
+	[[nodiscard]] virtual bool reuseLines(int fromY, int limitY) = 0;
+
 	/** Is video recording active?
 	  */
 	[[nodiscard]] virtual bool isRecording() const = 0;
@@ -118,6 +118,11 @@ RenderSettings::RenderSettings(CommandController& commandController)
 		"disablesprites", "disable sprite rendering",
 		false, Setting::Save::NO)
 
+	, renderThreadsSetting(commandController,
+		"render_threads", "number of extra threads used to convert "
+		"display lines to pixels, 0 = only use the emulation thread",
+		0, 0, 16)
+
 	, cmdTimingSetting(commandController,
 		"cmdtiming", "VDP command timing", false,
 		EnumSetting<bool>::Map{{"real", false}, {"broken", true}},
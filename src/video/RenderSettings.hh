@@ -143,6 +143,10 @@ public:
 	[[nodiscard]] BooleanSetting& getDisableSpritesSetting() { return disableSpritesSetting; }
 	[[nodiscard]] bool getDisableSprites() const { return disableSpritesSetting.getBoolean(); }
 
+	/** The number of extra threads used to convert display lines. */
+	[[nodiscard]] IntegerSetting& getRenderThreadsSetting() { return renderThreadsSetting; }
+	[[nodiscard]] int getRenderThreads() const { return renderThreadsSetting.getInt(); }
+
 	/** CmdTiming [real, broken].
 	  * This setting is intended for debugging only, not for users. */
 	[[nodiscard]] EnumSetting<bool>& getCmdTimingSetting() { return cmdTimingSetting; }
@@ -238,6 +242,7 @@ private:
 	IntegerSetting scanlineAlphaSetting;
 	BooleanSetting limitSpritesSetting;
 	BooleanSetting disableSpritesSetting;
+	IntegerSetting renderThreadsSetting;
 	EnumSetting<bool> cmdTimingSetting;
 	EnumSetting<bool> tooFastAccessSetting;
 	EnumSetting<DisplayDeform> displayDeformSetting;
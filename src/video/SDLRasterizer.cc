@@ -129,10 +129,13 @@ SDLRasterizer::SDLRasterizer(
 	renderSettings.getBrightnessSetting() .attach(*this);
 	renderSettings.getContrastSetting()   .attach(*this);
 	renderSettings.getColorMatrixSetting().attach(*this);
+	renderSettings.getRenderThreadsSetting().attach(*this);
+	workers.setNumWorkers(renderSettings.getRenderThreads());
 }
 
 SDLRasterizer::~SDLRasterizer()
 {
+	renderSettings.getRenderThreadsSetting().detach(*this);
 	renderSettings.getColorMatrixSetting().detach(*this);
 	renderSettings.getGammaSetting()      .detach(*this);
 	renderSettings.getBrightnessSetting() .detach(*this);
@@ -158,6 +161,10 @@ void SDLRasterizer::reset()
 	spriteConverter.setTransparency(vdp.getTransparency());
 
 	resetPalette();
+
+	// The previous frame was rendered with possibly different state.
+	workFrameComplete = false;
+	prevFrame = nullptr;
 }
 
 void SDLRasterizer::resetPalette()
@@ -179,6 +186,10 @@ void SDLRasterizer::setSuperimposeVideoFrame(const RawFrame* videoSource)
 
 void SDLRasterizer::frameStart(EmuTime time)
 {
+	// After rotateFrames() the finished frame is kept by the post processor
+	// at least until the next call, so it remains valid during this frame.
+	prevFrame = workFrameComplete ? workFrame.get() : nullptr;
+	workFrameComplete = false;
 	workFrame = postProcessor->rotateFrames(std::move(workFrame), time);
 	workFrame->init(
 	    vdp.isInterlaced() ? (vdp.getEvenOdd() ? FrameSource::FieldType::ODD
@@ -190,11 +201,17 @@ void SDLRasterizer::frameStart(EmuTime time)
 	// 240 - 212 = 28 lines available for top/bottom border; 14 each.
 	// NTSC: display at [32..244),
 	// PAL:  display at [59..271).
-	lineRenderTop = vdp.isPalTiming() ? 59 - 14 : 32 - 14;
+	int newLineRenderTop = vdp.isPalTiming() ? 59 - 14 : 32 - 14;
+	if (newLineRenderTop != lineRenderTop) {
+		// Lines of the previous frame are at a different position.
+		prevFrame = nullptr;
+		lineRenderTop = newLineRenderTop;
+	}
 }
 
 void SDLRasterizer::frameEnd()
 {
+	workFrameComplete = true;
 }
 
 void SDLRasterizer::setDisplayMode(DisplayMode mode)
@@ -584,7 +601,9 @@ void SDLRasterizer::drawDisplay(
 	pageBorder = std::min(pageBorder, pageSplit);
 
 	if (mode.isBitmapMode()) {
-		for (auto y : xrange(screenY, screenLimitY)) {
+		bitmapConverter.prepare();
+		forEachLine(screenY, screenLimitY, [&](int y) {
+			int lineY = (displayY + y - screenY) & 255;
 			// Which bits in the name mask determine the page?
 			// TODO optimize this?
 			//   Calculating pageMaskOdd/Even is a non-trivial amount
@@ -599,8 +618,8 @@ void SDLRasterizer::drawDisplay(
 				? (pageMaskOdd & ~0x100)
 				: pageMaskOdd;
 			const std::array<unsigned, 2> vramLine = {
-				convInterleaveToFlat(filMode, ((filMode ? 0x100 : 0) | (vram.nameTable.getMask() >> 7)) & (pageMaskEven | displayY)),
-				convInterleaveToFlat(filMode, ((filMode ? 0x100 : 0) | (vram.nameTable.getMask() >> 7)) & (pageMaskOdd  | displayY))
+				convInterleaveToFlat(filMode, ((filMode ? 0x100 : 0) | (vram.nameTable.getMask() >> 7)) & (pageMaskEven | lineY)),
+				convInterleaveToFlat(filMode, ((filMode ? 0x100 : 0) | (vram.nameTable.getMask() >> 7)) & (pageMaskOdd  | lineY))
 			};
 
 			std::array<Pixel, 512> buf;
@@ -630,26 +649,23 @@ void SDLRasterizer::drawDisplay(
 				copy_to_range(subspan(buf, x, displayWidth - firstPageWidth),
 				              subspan(dst, firstPageWidth));
 			}
-
-			displayY = (displayY + 1) & 255;
-		}
+		});
 	} else {
 		// horizontal scroll (high) is implemented in CharacterConverter
-		for (auto y : xrange(screenY, screenLimitY)) {
-			assert(!vdp.isMSX1VDP() || displayY < 192);
+		forEachLine(screenY, screenLimitY, [&](int y) {
+			int lineY = (displayY + y - screenY) & 255;
+			assert(!vdp.isMSX1VDP() || lineY < 192);
 
 			auto dst = workFrame->getLineDirect(y).subspan(leftBackground + displayX);
 			if ((displayX == 0) && (displayWidth == narrow<int>(lineWidth))){
-				characterConverter.convertLine(dst, displayY);
+				characterConverter.convertLine(dst, lineY);
 			} else {
 				std::array<Pixel, 512> buf;
-				characterConverter.convertLine(buf, displayY);
+				characterConverter.convertLine(buf, lineY);
 				auto src = subspan(buf, displayX, displayWidth);
 				copy_to_range(src, dst);
 			}
-
-			displayY = (displayY + 1) & 255;
-		}
+		});
 	}
 }
 
@@ -680,40 +696,79 @@ void SDLRasterizer::drawSprites(
 	int screenX = translateX(
 		vdp.getLeftSprites(),
 		vdp.getDisplayMode().getLineWidth() == 512);
+	auto drawLines = [&](auto drawLine) {
+		forEachLine(fromY, limitY, [&](int y) {
+			auto dst = workFrame->getLineDirect(screenY + y - fromY).subspan(screenX);
+			drawLine(y, dst);
+		});
+	};
 	if (spriteMode == 3) {
-		for (int y = fromY; y < limitY; y++, screenY++) {
-			auto dst = workFrame->getLineDirect(screenY).subspan(screenX);
+		drawLines([&](int y, std::span<Pixel> dst) {
 			spriteConverter.drawMode3(y, displayX, displayLimitX, dst);
-		}
+		});
 	} else if (spriteMode == 1) {
-		for (int y = fromY; y < limitY; y++, screenY++) {
-			auto dst = workFrame->getLineDirect(screenY).subspan(screenX);
+		drawLines([&](int y, std::span<Pixel> dst) {
 			spriteConverter.drawMode1(y, displayX, displayLimitX, dst);
-		}
+		});
 	} else {
 		uint8_t mode = vdp.getDisplayMode().getByte();
 		if (mode == DisplayMode::GRAPHIC5) {
-			for (int y = fromY; y < limitY; y++, screenY++) {
-				auto dst = workFrame->getLineDirect(screenY).subspan(screenX);
+			drawLines([&](int y, std::span<Pixel> dst) {
 				spriteConverter.template drawMode2<DisplayMode::GRAPHIC5>(
 					y, displayX, displayLimitX, dst);
-			}
+			});
 		} else if (mode == DisplayMode::GRAPHIC6) {
-			for (int y = fromY; y < limitY; y++, screenY++) {
-				auto dst = workFrame->getLineDirect(screenY).subspan(screenX);
+			drawLines([&](int y, std::span<Pixel> dst) {
 				spriteConverter.template drawMode2<DisplayMode::GRAPHIC6>(
 					y, displayX, displayLimitX, dst);
-			}
+			});
 		} else {
-			for (int y = fromY; y < limitY; y++, screenY++) {
-				auto dst = workFrame->getLineDirect(screenY).subspan(screenX);
+			drawLines([&](int y, std::span<Pixel> dst) {
 				spriteConverter.template drawMode2<DisplayMode::GRAPHIC4>(
 					y, displayX, displayLimitX, dst);
-			}
+			});
 		}
 	}
 }
 
+void SDLRasterizer::forEachLine(
+	int fromY, int limitY, const std::function<void(int)>& drawLine)
+{
+	// Don't bother the other threads for only a few lines.
+	static constexpr int MIN_LINES_PER_JOB = 16;
+	int numLines = limitY - fromY;
+	unsigned numJobs = std::min(workers.getNumWorkers() + 1,
+	                            unsigned(std::max(numLines / MIN_LINES_PER_JOB, 1)));
+	// Each job draws a disjoint range of lines.
+	workers.run(numJobs, [&](unsigned job) {
+		int y0 = fromY + narrow<int>(job * numLines / numJobs);
+		int y1 = fromY + narrow<int>((job + 1) * numLines / numJobs);
+		for (auto y : xrange(y0, y1)) drawLine(y);
+	});
+}
+
+bool SDLRasterizer::reuseLines(int fromY, int limitY)
+{
+	if (!prevFrame) return false;
+
+	int startY = std::max(fromY - lineRenderTop, 0);
+	int endY = std::min(limitY - lineRenderTop, 240);
+	// Copy the borders as well: they're either already drawn with the same
+	// state (left border) or will be overwritten with the same pixels
+	// (right border). The line width is still set by drawBorder().
+	unsigned width = (vdp.getDisplayMode().getLineWidth() == 512) ? 640 : 320;
+	for (auto y : xrange(startY, endY)) {
+		// Safety net: the line must have the same width as the
+		// line we'd render now.
+		if (prevFrame->getLineWidthDirect(y) != width) return false;
+	}
+	for (auto y : xrange(startY, endY)) {
+		copy_to_range(prevFrame->getLineDirect(y).subspan(0, width),
+		              workFrame->getLineDirect(y));
+	}
+	return true;
+}
+
 bool SDLRasterizer::isRecording() const
 {
 	return postProcessor->isRecording();
@@ -727,6 +782,10 @@ void SDLRasterizer::update(const Setting& setting) noexcept
 	                       &renderSettings.getColorMatrixSetting())) {
 		precalcPalette();
 		resetPalette();
+		workFrameComplete = false;
+		prevFrame = nullptr;
+	} else if (&setting == &renderSettings.getRenderThreadsSetting()) {
+		workers.setNumWorkers(renderSettings.getRenderThreads());
 	}
 }
 
@@ -7,9 +7,11 @@
 #include "SpriteConverter.hh"
 
 #include "Observer.hh"
+#include "WorkerPool.hh"
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 namespace openmsx {
@@ -64,11 +66,18 @@ public:
 		int fromX, int fromY,
 		int displayX, int displayY,
 		int displayWidth, int displayHeight) override;
+	[[nodiscard]] bool reuseLines(int fromY, int limitY) override;
 	[[nodiscard]] bool isRecording() const override;
 
 private:
 	inline void renderBitmapLine(std::span<Pixel> buf, unsigned vramLine);
 
+	/** Call drawLine(y) for all lines in [fromY, limitY). When there are
+	  * enough lines, they're divided over the render threads.
+	  */
+	void forEachLine(int fromY, int limitY,
+	                 const std::function<void(int)>& drawLine);
+
 	/** Reload entire palette from VDP.
 	  */
 	void resetPalette();
@@ -114,6 +123,15 @@ private:
 	  */
 	std::unique_ptr<RawFrame> workFrame;
 
+	/** The previously rendered frame, used by reuseLines(). It is still
+	  * owned by the post processor, nullptr if it can't be used.
+	  */
+	const RawFrame* prevFrame = nullptr;
+
+	/** Is workFrame a completely rendered frame with the current settings?
+	  */
+	bool workFrameComplete = false;
+
 	/** The current renderer settings (gamma, brightness, contrast)
 	  */
 	RenderSettings& renderSettings;
@@ -130,10 +148,14 @@ private:
 	  */
 	SpriteConverter spriteConverter;
 
+	/** Threads that help converting lines, see forEachLine().
+	  */
+	WorkerPool workers;
+
 	/** Line to render at top of display.
 	  * After all, our screen is 240 lines while display is 262 or 313.
 	  */
-	int lineRenderTop;
+	int lineRenderTop = 0;
 
 	/** Host colors corresponding to each VDP palette entry.
 	  * palFg has entry 0 set to the current background color.
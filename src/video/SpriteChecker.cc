@@ -14,6 +14,7 @@ TODO:
 
 #include "BooleanSetting.hh"
 #include "serialize.hh"
+#include "xrange.hh"
 
 #include <algorithm>
 #include <bit>
@@ -499,64 +500,97 @@ void SpriteChecker::updateSprites3(int limit)
 	currentLine = limit;
 }
 
+void SpriteChecker::updatePlanes3(std::span<const uint8_t, 64 * 8> attributes)
+{
+	planesY216 = 0;
+	for (auto plane : xrange(64)) {
+		auto attr = subspan<8>(attributes, 8 * plane);
+		int y = attr[0] | ((attr[1] & 0x03) << 8);
+		y |= (y & 0x200) ? ~0x1FF : 0x000;
+		int mgy = attr[2] ? attr[2] : 256;
+		if (y == 216) planesY216 |= uint64_t(1) << plane;
+
+		auto& range = planeRanges[plane];
+		if ((range.begin == y) && (range.end == y + mgy)) continue;
+		togglePlaneLines(plane, range);
+		range = {y, y + mgy};
+		togglePlaneLines(plane, range);
+	}
+}
+
+void SpriteChecker::togglePlaneLines(int plane, PlaneRange range)
+{
+	uint64_t bit    = uint64_t(1) << plane;
+	uint64_t spsBit = uint64_t(1) << ((plane * SPS_ORDER_MUL) & 63);
+	int begin = std::max(range.begin - PLANE_LINE_MIN, 0);
+	int end   = std::min(range.end   - PLANE_LINE_MIN, int(planeLines.size()));
+	for (int i = begin; i < end; ++i) {
+		planeLines   [i] ^= bit;
+		planeLinesSps[i] ^= spsBit;
+	}
+}
+
 inline void SpriteChecker::checkSprites3(int minLine, int maxLine)
 {
 	int displayDelta = (vdp.isSVNS() ? 0 : vdp.getVerticalScroll()) - vdp.getLineZero();
 
 	// Get sprites for this line and detect 17th sprite if any.
 	bool limitSprites = limitSpritesSetting.getBoolean();
-	int size = vdp.getSpriteSize();
 	auto attributePtr = vram.spriteAttribTable.getReadArea<64 * 8>(0);
-	uint8_t patternIndexMask = size == 16 ? 0xFC : 0xFF;
-	int fifthSpriteNum  = -1;  // no 5th sprite detected yet
-	int fifthSpriteLine = 999; // larger than any possible valid line
+	updatePlanes3(attributePtr);
+	int fifthSpriteNum  = -1;  // no 17th sprite detected yet
 	int maxVisible = 16;
-
-	int sprite = vdp.isSPS() ? (vdp.getSpsTopPlane() & 63) : 0;
-	for (int count = 0; count < 64; ++count, sprite = vdp.isSPS() ? ((sprite + SPS_NEXT_PLANE) & 63) : (sprite + 1)) {
-		int y = attributePtr[8 * sprite + 0] | ((attributePtr[8 * sprite + 1] & 0x03) << 8);
-		y |= (y & 0x200) ? ~0x1FF : 0x000;
-
-		if (y == 216 && !vdp.isSPS()) break;
-
-		int x = attributePtr[8 * sprite + 4] | ((attributePtr[8 * sprite + 5] & 0x03) << 8);
-		x |= (x & 0x200) ? ~0x1FF : 0x000;
-		int mgx = attributePtr[8 * sprite + 6];
-		if (mgx == 0) mgx = 256;
-		int mgy = attributePtr[8 * sprite + 2];
-		if (mgy == 0) mgy = 256;
-
-		uint8_t sz = (attributePtr[8 * sprite + 1] >> 6) & 0x03;	// size
-		uint8_t pts = (attributePtr[8 * sprite + 5] >> 4) & 0x07;	// pattern set
-		uint8_t px = attributePtr[8 * sprite + 7] & 0x0F;			// pattern x
-		uint8_t py = (attributePtr[8 * sprite + 7] >> 4) & 0x0F;	// pattern y
-		bool rvy = (attributePtr[8 * sprite + 3] & 0x20) != 0;
-		bool rvx = (attributePtr[8 * sprite + 3] & 0x10) != 0;
-		uint8_t ps = attributePtr[8 * sprite + 3] & 0x0F;
-		uint8_t tp = (attributePtr[8 * sprite + 3] >> 6) & 0x03;
-
-		for (int line = minLine; line < maxLine; ++line) { // 'line' changes in loop
-			// Calculate line number within the sprite.
-			int displayLine = line + displayDelta;
-			int spriteLine = displayLine - y;
-			if (spriteLine >= mgy) {
-				break;
-			}
-			if (spriteLine < 0) {
-				line -= spriteLine;
-				line--;
-				continue;
-			}
-
-			auto visibleIndex = spriteCount[line];
+	int maxStored = limitSprites ? maxVisible : 32; // size of spriteBuffer
+
+	bool sps = vdp.isSPS();
+	int topPlane = sps ? (vdp.getSpsTopPlane() & 63) : 0;
+	int spsRotate = (topPlane * SPS_ORDER_MUL) & 63;
+	// Without SPS, a sprite with Y-coordinate 216 hides itself and all
+	// sprites with a higher plane number.
+	int stopPlane = std::countr_zero(planesY216);
+	uint64_t enabledPlanes = (sps || stopPlane == 64)
+	                       ? ~uint64_t(0)
+	                       : (uint64_t(1) << stopPlane) - 1;
+
+	for (int line = minLine; line < maxLine; ++line) {
+		int displayLine = line + displayDelta;
+		auto idx = unsigned(displayLine - PLANE_LINE_MIN);
+		if (idx >= planeLines.size()) continue;
+		// The planes on this line, in the order they're checked: bit n
+		// is the n-th checked plane.
+		uint64_t planes = sps ? std::rotr(planeLinesSps[idx], spsRotate)
+		                      : (planeLines[idx] & enabledPlanes);
+
+		auto visibleIndex = spriteCount[line];
+		for (/**/; planes; planes &= planes - 1) {
+			int n = std::countr_zero(planes);
+			int sprite = sps ? ((topPlane + n * SPS_NEXT_PLANE) & 63) : n;
 			if (visibleIndex == maxVisible) {
-				// Find earliest line where this condition occurs.
-				if (line < fifthSpriteLine) {
-					fifthSpriteLine = line;
-					fifthSpriteNum = sprite;
-				}
-				if (limitSprites) continue;
+				// Lines are checked in order, so this is the
+				// earliest line where this condition occurs.
+				if (fifthSpriteNum == -1) fifthSpriteNum = sprite;
 			}
+			if (visibleIndex == maxStored) break;
+
+			auto attr = subspan<8>(attributePtr, 8 * sprite);
+			int y = planeRanges[sprite].begin;
+			int mgy = planeRanges[sprite].end - y;
+			int spriteLine = displayLine - y;
+			assert(0 <= spriteLine && spriteLine < mgy);
+
+			int x = attr[4] | ((attr[5] & 0x03) << 8);
+			x |= (x & 0x200) ? ~0x1FF : 0x000;
+			int mgx = attr[6];
+			if (mgx == 0) mgx = 256;
+
+			uint8_t sz = (attr[1] >> 6) & 0x03;	// size
+			uint8_t pts = (attr[5] >> 4) & 0x07;	// pattern set
+			uint8_t px = attr[7] & 0x0F;			// pattern x
+			uint8_t py = (attr[7] >> 4) & 0x0F;	// pattern y
+			bool rvy = (attr[3] & 0x20) != 0;
+			bool rvx = (attr[3] & 0x10) != 0;
+			uint8_t ps = attr[3] & 0x0F;
+			uint8_t tp = (attr[3] >> 6) & 0x03;
 
 			SpriteInfo& sip = spriteBuffer[line][visibleIndex];
 
@@ -592,8 +626,9 @@ inline void SpriteChecker::checkSprites3(int minLine, int maxLine)
 			sip.mgx = mgx;
 			sip.paletteSet = ps;
 			sip.transparent = tp;
-			spriteCount[line] = visibleIndex + 1;
+			++visibleIndex;
 		}
+		spriteCount[line] = visibleIndex;
 	}
 
 	// Update status register.
@@ -608,6 +643,10 @@ inline void SpriteChecker::checkSprites3(int minLine, int maxLine)
 	}
 	if (~status & 0x40) {
 		// No 5th sprite detected, store number of latest sprite processed.
+		// With SPS all 64 planes are checked, ending at the top plane
+		// again. Without SPS checking stops at a sprite with
+		// Y-coordinate 216.
+		int sprite = sps ? topPlane : stopPlane;
 		status = (status & 0x20) | uint8_t(std::min(sprite, 63));
 	}
 	vdp.setSpriteStatus(status);
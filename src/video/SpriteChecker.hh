@@ -26,6 +26,12 @@ class SpriteChecker final : public VRAMObserver
 public:
 	static constexpr int SPS_NEXT_PLANE = 19;
 	static constexpr int SPS_NEXT_FRAME = 5;
+	/** Multiplicative inverse of SPS_NEXT_PLANE (modulo 64): with SPS
+	  * the n-th checked plane is 'top + n * SPS_NEXT_PLANE', so plane
+	  * 'p' is checked as number '(p - top) * SPS_ORDER_MUL'.
+	  */
+	static constexpr int SPS_ORDER_MUL = 27;
+	static_assert(((SPS_NEXT_PLANE * SPS_ORDER_MUL) & 63) == 1);
 
 	/** Bitmap of length 32 describing a sprite pattern.
 	  * Visible pixels are 1, transparent pixels are 0.
@@ -358,8 +364,28 @@ private:
 	  */
 	void checkSprites2(int minLine, int maxLine);
 
+	/** Check sprite collision and number of sprites per line.
+	  * This routine implements sprite mode 3 (V9968). Instead of testing
+	  * all 64 planes for every line, it looks up the planes that cover a
+	  * line in 'planeLines'.
+	  */
 	void checkSprites3(int minLine, int maxLine);
 
+	/** Display lines [begin, end) covered by a sprite mode 3 plane. */
+	struct PlaneRange {
+		int begin = 0;
+		int end = 0;
+	};
+
+	/** Bring 'planeRanges', 'planeLines' and 'planeLinesSps' up to date
+	  * with the sprite attribute table. Only the lines of planes whose
+	  * vertical position or magnification changed are touched.
+	  */
+	void updatePlanes3(std::span<const uint8_t, 64 * 8> attributes);
+
+	/** Add or remove (toggle) a plane in the masks of the given lines. */
+	void togglePlaneLines(int plane, PlaneRange range);
+
 private:
 	using UpdateSpritesMethod = void (SpriteChecker::*)(int limit);
 	UpdateSpritesMethod updateSpritesMethod;
@@ -416,6 +442,25 @@ private:
 	  * TODO: Introduce separate update methods for planar/non-planar modes.
 	  */
 	bool planar;
+
+	/** Sprite mode 3: the lines covered by each plane, as seen by the
+	  * last call to updatePlanes3().
+	  */
+	std::array<PlaneRange, 64> planeRanges = {};
+
+	/** Sprite mode 3: for each display line a bitmask of the planes that
+	  * cover that line. Indexed by 'displayLine - PLANE_LINE_MIN', which
+	  * covers all possible sprite Y-coordinates and magnifications.
+	  * In 'planeLines' bit 'p' is plane 'p', in 'planeLinesSps' bit
+	  * 'p * SPS_ORDER_MUL' is plane 'p' (so that a rotation puts the bits
+	  * in SPS checking order).
+	  */
+	static constexpr int PLANE_LINE_MIN = -512;
+	std::array<uint64_t, 512 + 512 + 256> planeLines = {};
+	std::array<uint64_t, 512 + 512 + 256> planeLinesSps = {};
+
+	/** Sprite mode 3: bitmask of the planes with Y-coordinate 216. */
+	uint64_t planesY216 = 0;
 };
 SERIALIZE_CLASS_VERSION(SpriteChecker, 2);
 
@@ -1156,6 +1156,18 @@ uint8_t VDP::readIO(uint16_t port, EmuTime time_)
 	}
 }
 
+// The VDP ports are the most frequently used ones (e.g. VRAM transfers),
+// give them a direct entry point.
+MSXDevice::ReadIOFunc VDP::getReadIOFunc() const
+{
+	return &readIOThunk<VDP>;
+}
+
+MSXDevice::WriteIOFunc VDP::getWriteIOFunc() const
+{
+	return &writeIOThunk<VDP>;
+}
+
 uint8_t VDP::peekIO(uint16_t /*port*/, EmuTime /*time*/) const
 {
 	// TODO not implemented
@@ -1286,6 +1298,11 @@ void VDP::changeRegister(uint8_t reg, uint8_t val, EmuTime time)
 		}
 		break;
 	case 20:
+		if (change & 0x21) {
+			// HS and ECOM change how commands execute, don't let a
+			// deferred command see the new value too early.
+			cmdEngine->sync(time);
+		}
 		if (   (hasSP3()  && (change & 0x08))
 			|| (hasEPAL() && (change & 0x10))
 			|| (hasILNS() && (change & 0x04))
@@ -103,11 +103,21 @@ public:
 	[[nodiscard]] uint8_t readIO(uint16_t port, EmuTime time) override;
 	[[nodiscard]] uint8_t peekIO(uint16_t port, EmuTime time) const override;
 	void writeIO(uint16_t port, uint8_t value, EmuTime time) override;
+	[[nodiscard]] ReadIOFunc  getReadIOFunc()  const override;
+	[[nodiscard]] WriteIOFunc getWriteIOFunc() const override;
 
 	void getExtraDeviceInfo(TclObject& result) const override;
 	[[nodiscard]] std::string_view getVersionString() const;
 
 	[[nodiscard]] uint8_t peekRegister(unsigned address, EmuTime time) const;
+
+	/** Get the current values of the control registers R#0 - R#31.
+	  * Used by the renderer to detect register changes it isn't
+	  * explicitly notified about.
+	  */
+	[[nodiscard]] const std::array<uint8_t, 32>& getControlRegs() const {
+		return controlRegs;
+	}
 	[[nodiscard]] uint8_t peekStatusReg(uint8_t reg, EmuTime time) const;
 
 	/** VDP control register has changed, work out the consequences.
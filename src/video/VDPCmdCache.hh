@@ -1,6 +1,12 @@
 #ifndef VDPCMDCACHE_HH
 #define VDPCMDCACHE_HH
 
+#include "xrange.hh"
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
 namespace openmsx::VDPCmdCache {
 enum class CachePenalty : int {
 	CACHE_NONE          = 0,
@@ -17,7 +23,133 @@ enum class CachePenalty : int {
 	CACHE_FLUSH_4		= 11
 };
 
-// ToDo: Move the cache processing from VDPCmdEngine.hh
-}
+/** The cache accesses that are counted, see Cache::getCounters().
+  * The order matches the READ/WRITE part of CachePenalty.
+  */
+enum class Stat : uint8_t {
+	READ_HIT, READ_MISS, READ_FLUSH,
+	WRITE_HIT, WRITE_MISS, WRITE_FLUSH,
+	NUM
+};
+static constexpr unsigned NUM_STATS = unsigned(Stat::NUM);
+static constexpr unsigned NUM_COMMANDS = 16; // upper nibble of CMD register
+
+/** Access counters, indexed by [command][Stat].
+  */
+using Counters = std::array<std::array<uint32_t, NUM_STATS>, NUM_COMMANDS>;
+
+/** Model of the write-back cache in front of VRAM that is used by the
+  * high-speed command engine. Each entry holds one 32-bit word (four
+  * consecutive bytes). Only the timing aspect is modelled: the data itself
+  * always goes straight to VRAM.
+  *
+  * The state is stored as a structure of arrays: the word address of each
+  * entry plus a few packed state bits, so that a lookup can check all
+  * entries without branching.
+  */
+class Cache
+{
+public:
+	static constexpr unsigned NUM_ENTRIES = 4;
+
+	/** Invalidate all entries. The counters are not touched.
+	  */
+	void reset() {
+		state.fill(0);
+		priority = 0;
+	}
+
+	/** Select the command for which subsequent accesses are counted.
+	  * @param cmd The command code (upper nibble of the CMD register).
+	  */
+	void setCommand(unsigned cmd) {
+		command = cmd & (NUM_COMMANDS - 1);
+	}
+
+	/** Read or write a byte through the cache.
+	  * @param write Is this a write access?
+	  * @param addr The VRAM address.
+	  * @return The penalty for this access, used for timing.
+	  */
+	CachePenalty check(bool write, unsigned addr) {
+		unsigned word = addr >> 2;
+		auto bit = uint8_t(1 << (addr & 3));
+
+		unsigned valid = 0;    // entries in use
+		unsigned match = 0;    // entries in use for this word
+		unsigned readable = 0; // entries that can serve a read of this byte
+		for (auto i : xrange(NUM_ENTRIES)) {
+			unsigned v = (state[i] & VALID) != 0;
+			unsigned m = v & unsigned(address[i] == word);
+			valid    |= v << i;
+			match    |= m << i;
+			readable |= (m & unsigned((state[i] & (READ | bit)) != 0)) << i;
+		}
+
+		if (write) {
+			if (match) {
+				state[std::countr_zero(match)] |= bit;
+				return count(CachePenalty::CACHE_WRITE_HIT);
+			}
+			if (unsigned free = ~valid & ALL_ENTRIES) {
+				fill(std::countr_zero(free), word, bit);
+				return count(CachePenalty::CACHE_WRITE_MISS);
+			}
+		} else if (readable) {
+			return count(CachePenalty::CACHE_READ_HIT);
+		}
+
+		// Replace the oldest entry, dirty data gets written back.
+		// Note: a read never takes a free entry.
+		fill(priority, word, write ? bit : READ);
+		priority = (priority + 1) % NUM_ENTRIES;
+		return count(write ? CachePenalty::CACHE_WRITE_FLUSH
+		                   : CachePenalty::CACHE_READ_FLUSH);
+	}
+
+	/** Write back all dirty entries (at the end of a command).
+	  * @return The penalty, depends on the number of written entries.
+	  */
+	CachePenalty flush() {
+		int cnt = 0;
+		for (auto& s : state) {
+			bool dirty = (s & VALID) && (s & DIRTY);
+			cnt += dirty;
+			s = dirty ? uint8_t(0) : s;
+		}
+		return CachePenalty(int(CachePenalty::CACHE_FLUSH_0) + cnt);
+	}
+
+	[[nodiscard]] const Counters& getCounters() const { return counters; }
+	[[nodiscard]] Counters& getCounters() { return counters; }
+	void resetCounters() { counters = {}; }
+
+private:
+	// bits in 'state'
+	static constexpr uint8_t DIRTY = 0x0F; // bytes written, not yet in VRAM
+	static constexpr uint8_t VALID = 0x10; // entry in use
+	static constexpr uint8_t READ  = 0x20; // whole word was read from VRAM
+	static constexpr unsigned ALL_ENTRIES = (1 << NUM_ENTRIES) - 1;
+
+	void fill(unsigned i, unsigned word, uint8_t bits) {
+		address[i] = word;
+		state[i] = VALID | bits;
+	}
+
+	CachePenalty count(CachePenalty penalty) {
+		auto stat = int(penalty) - int(CachePenalty::CACHE_READ_HIT);
+		++counters[command][stat];
+		return penalty;
+	}
+
+private:
+	std::array<unsigned, NUM_ENTRIES> address = {};
+	std::array<uint8_t, NUM_ENTRIES> state = {};
+	unsigned priority = 0;
+	unsigned command = 0;
+	Counters counters = {};
+};
+
+} // namespace openmsx::VDPCmdCache
 
 #endif
@@ -38,9 +38,13 @@ TODO:
 #include "VDPVRAM.hh"
 
 #include "EmuTime.hh"
+#include "MSXMotherBoard.hh"
 #include "serialize.hh"
 
+#include "narrow.hh"
+#include "outer.hh"
 #include "unreachable.hh"
+#include "xrange.hh"
 
 #include <algorithm>
 #include <array>
@@ -157,6 +161,40 @@ static void setWriteMask(EmuTime time, VDPVRAM &vram, bool evr, bool enable) {
 	}
 }
 
+using VRAMRun = VDPCmdEngine::VRAMRun;
+
+/** Split a row of 'num' bytes, starting at byte 'bx' (the leftmost byte of
+  * the row), into contiguous runs in VRAM. Planar modes need two runs (one
+  * for the bytes with the same parity as 'bx', one for the others), the
+  * other modes only use the first run.
+  */
+template<typename Mode>
+static std::array<VRAMRun, 2> getRowRuns(unsigned bx, unsigned y, unsigned num, bool evr)
+{
+	auto addr = [&](unsigned b) {
+		return Mode::addressOf(b << Mode::PIXELS_PER_BYTE_SHIFT, y, evr, false);
+	};
+	if constexpr (Mode::PLANAR) {
+		return {VRAMRun{addr(bx), (num + 1) / 2}, VRAMRun{addr(bx + 1), num / 2}};
+	} else {
+		return {VRAMRun{addr(bx), num}, VRAMRun{0, 0}};
+	}
+}
+
+/** Leftmost byte of a row of 'num' bytes that starts at pixel 'x'.
+  */
+template<typename Mode>
+static unsigned getRowLeft(unsigned x, unsigned num, uint8_t ARG)
+{
+	unsigned bx = x >> Mode::PIXELS_PER_BYTE_SHIFT;
+	return (ARG & VDPCmdEngine::DIX) ? (bx - (num - 1)) : bx;
+}
+
+static bool overlaps(VRAMRun a, VRAMRun b)
+{
+	return (a.addr < b.addr + b.num) && (b.addr < a.addr + a.num);
+}
+
 //struct IncrByteAddr4;
 //struct IncrByteAddr5;
 //struct IncrByteAddr6;
@@ -195,6 +233,7 @@ struct Graphic4Mode
 	static constexpr uint8_t PIXELS_PER_BYTE = 2;
 	static constexpr uint8_t PIXELS_PER_BYTE_SHIFT = 1;
 	static constexpr unsigned PIXELS_PER_LINE = 256;
+	static constexpr bool PLANAR = false;
 	static unsigned addressOf(unsigned x, unsigned y, bool evr, bool extVRAM);
 	static uint8_t point(const VDPVRAM& vram, unsigned x, unsigned y, bool evr, bool extVRAM);
 	template<typename LogOp>
@@ -249,6 +288,7 @@ struct Graphic5Mode
 	static constexpr uint8_t PIXELS_PER_BYTE = 4;
 	static constexpr uint8_t PIXELS_PER_BYTE_SHIFT = 2;
 	static constexpr unsigned PIXELS_PER_LINE = 512;
+	static constexpr bool PLANAR = false;
 	static unsigned addressOf(unsigned x, unsigned y, bool evr, bool extVRAM);
 	static uint8_t point(const VDPVRAM& vram, unsigned x, unsigned y, bool evr, bool extVRAM);
 	template<typename LogOp>
@@ -305,6 +345,7 @@ struct Graphic6Mode
 	static constexpr uint8_t PIXELS_PER_BYTE = 2;
 	static constexpr uint8_t PIXELS_PER_BYTE_SHIFT = 1;
 	static constexpr unsigned PIXELS_PER_LINE = 512;
+	static constexpr bool PLANAR = true;
 	static unsigned addressOf(unsigned x, unsigned y, bool evr, bool extVRAM);
 	static uint8_t point(const VDPVRAM& vram, unsigned x, unsigned y, bool evr, bool extVRAM);
 	template<typename LogOp>
@@ -359,6 +400,7 @@ struct Graphic7Mode
 	static constexpr uint8_t PIXELS_PER_BYTE = 1;
 	static constexpr uint8_t PIXELS_PER_BYTE_SHIFT = 0;
 	static constexpr unsigned PIXELS_PER_LINE = 256;
+	static constexpr bool PLANAR = true;
 	static unsigned addressOf(unsigned x, unsigned y, bool evr, bool extVRAM);
 	static uint8_t point(const VDPVRAM& vram, unsigned x, unsigned y, bool evr, bool extVRAM);
 	template<typename LogOp>
@@ -411,6 +453,7 @@ struct NonBitmapMode
 	static constexpr uint8_t PIXELS_PER_BYTE = 1;
 	static constexpr uint8_t PIXELS_PER_BYTE_SHIFT = 0;
 	static constexpr unsigned PIXELS_PER_LINE = 256;
+	static constexpr bool PLANAR = false;
 	static unsigned addressOf(unsigned x, unsigned y, bool evr, bool extVRAM);
 	static uint8_t point(const VDPVRAM& vram, unsigned x, unsigned y, bool evr, bool extVRAM);
 	template<typename LogOp>
@@ -787,13 +830,56 @@ void VDPCmdEngine::calcFinishTime(unsigned nx, unsigned ny, unsigned ticksPerPix
 	setStatusChangeTime(engineTime + t);
 }
 
+/** Calculate the VRAM area that the current block command writes, so that
+  * in lazy mode its execution can be deferred until that area is observed.
+  * The area is the full width of the destination lines; it's only valid if
+  * those lines are contiguous in VRAM (IOW the command doesn't wrap).
+  */
+template<typename Mode>
+void VDPCmdEngine::calcReach(unsigned tmpNY)
+{
+	deferrable = false;
+	if (!CMD || !cmdLazySetting.getBoolean() || getMXD(ARG, vdp.hasEVR())) {
+		return;
+	}
+	constexpr unsigned BYTES_PER_LINE =
+		Mode::PIXELS_PER_LINE >> Mode::PIXELS_PER_BYTE_SHIFT;
+	bool evr = vdp.isEVR();
+	unsigned y0 = (ARG & DIY) ? (DY - (tmpNY - 1)) : DY;
+	unsigned y1 = y0 + tmpNY - 1;
+	auto first = getRowRuns<Mode>(0, y0,     BYTES_PER_LINE, evr);
+	auto next  = getRowRuns<Mode>(0, y0 + 1, BYTES_PER_LINE, evr);
+	auto last  = getRowRuns<Mode>(0, y1,     BYTES_PER_LINE, evr);
+	for (auto i : xrange(2)) {
+		if (first[i].num == 0) {
+			reach[i] = VRAMRun{0, 0};
+			continue;
+		}
+		unsigned stride = next[i].addr - first[i].addr;
+		if ((last[i].addr < first[i].addr) ||
+		    ((last[i].addr - first[i].addr) != (y1 - y0) * stride)) {
+			return;
+		}
+		reach[i] = VRAMRun{first[i].addr,
+		                   last[i].addr + last[i].num - first[i].addr};
+	}
+	deferrable = true;
+}
+
+bool VDPCmdEngine::isReachObserved() const
+{
+	return std::ranges::any_of(reach, [&](const VRAMRun& run) {
+		return run.num && vram.isObserved(run.addr, run.addr + run.num - 1);
+	});
+}
+
 /** Abort
   */
 void VDPCmdEngine::startAbrt(EmuTime time)
 {
 	if (vdp.useHS()) {
 		auto calculator = getSlotCalculator(time);
-		calculator.nextHs(0, 0, flushCache());
+		calculator.nextHs(0, 0, cache.flush());
 		commandDone(calculator.getTime());
 		return;
 	}
@@ -830,7 +916,7 @@ void VDPCmdEngine::startPointHs(EmuTime time)
 	setReadMask(time, vram, vdp.hasEVR(), true);	//vram.cmdReadWindow.setMask(0x3FFFF, ~0u << 18, time);
 	setWriteMask(time, vram, vdp.hasEVR(), false);	//vram.cmdWriteWindow.disable(time);
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitPoint, checkCache(false, Mode::addressOf(SX, SY, vdp.isEVR(), srcExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitPoint, cache.check(false, Mode::addressOf(SX, SY, vdp.isEVR(), srcExt)));
 	setStatusChangeTime(EmuTime::zero()); // will finish soon
 }
 
@@ -893,7 +979,7 @@ void VDPCmdEngine::startPsetHs(EmuTime time)
 	setReadMask(time, vram, vdp.hasEVR(), false);	//vram.cmdReadWindow.disable(time);
 	setWriteMask(time, vram, vdp.hasEVR(), true);	//vram.cmdWriteWindow.setMask(0x3FFFF, ~0u << 18, time);
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitPset, checkCache(false, Mode::addressOf(DX, DY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitPset, cache.check(false, Mode::addressOf(DX, DY, vdp.isEVR(), dstExt)));
 	setStatusChangeTime(EmuTime::zero()); // will finish soon
 	phase = 0;
 }
@@ -911,7 +997,7 @@ void VDPCmdEngine::executePsetHs(EmuTime limit)
 		if (doPset) [[likely]] {
 			tmpDst = vram.cmdWriteWindow.readNP(addr);
 		}
-		nextAccessSlotHs(1, vdp.isHS() ? 0 : waitPset, checkCache(true, Mode::addressOf(DX, DY, vdp.isEVR(), dstExt)));
+		nextAccessSlotHs(1, vdp.isHS() ? 0 : waitPset, cache.check(true, Mode::addressOf(DX, DY, vdp.isEVR(), dstExt)));
 		[[fallthrough]];
 	case 1:
 		if (engineTime >= limit) [[unlikely]] { phase = 1; break; }
@@ -981,7 +1067,7 @@ void VDPCmdEngine::startSrchHs(EmuTime time)
 	setWriteMask(time, vram, vdp.hasEVR(), false);	//vram.cmdWriteWindow.disable(time);
 	ASX = SX;
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitSrch, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitSrch, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
 	setStatusChangeTime(EmuTime::zero()); // we can find it any moment
 }
 
@@ -1008,18 +1094,18 @@ void VDPCmdEngine::executeSrchHs(EmuTime limit)
 		}();
 		if ((p == CL) ^ AEQ) {
 			status |= BD; // border detected
-			calculator.nextHs(1, 0, flushCache());
+			calculator.nextHs(1, 0, cache.flush());
 			commandDone(calculator.getTime());
 			break;
 		}
 		ASX += TX;
 		if (ASX & Mode::PIXELS_PER_LINE) {
 			// this does NOT reset the BD flag!
-			calculator.nextHs(1, 0, flushCache());
+			calculator.nextHs(1, 0, cache.flush());
 			commandDone(calculator.getTime());
 			break;
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitSrch, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitSrch, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
 	}
 	engineTime = calculator.getTime();
 }
@@ -1133,7 +1219,7 @@ void VDPCmdEngine::startLineHs(EmuTime time)
 	ADX = DX;
 	ANX = 0;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLine, checkCache(false, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLine, cache.check(false, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 	setStatusChangeTime(EmuTime::zero()); // TODO can still be optimized
 	phase = 0;
 }
@@ -1156,7 +1242,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 		if (doPset) [[likely]] {
 			tmpDst = vram.cmdWriteWindow.readNP(addr);
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLine, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLine, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 		[[fallthrough]];
 	case 1: {
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
@@ -1173,7 +1259,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			//  - (ADX & PPL) test only happens after first pixel
 			//    is drawn. And it does test with 'AND' (not with ==)
 			if (ANX++ == NX || (ADX & Mode::PIXELS_PER_LINE)) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
@@ -1185,7 +1271,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 				// Same for the block commands, but those handle it via
 				// clipNY_1() and clipNY_2().
 				if ((TY < 0) && (int(DY) < 0)) {
-					calculator.nextHs(1, 0, flushCache());
+					calculator.nextHs(1, 0, cache.flush());
 					commandDone(calculator.getTime());
 					break;
 				}
@@ -1197,7 +1283,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			// confirmed on real HW: DY += TY happens before end-test
 			DY += TY;
 			if ((TY < 0) && (int(DY) < 0)) { // see comment above
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
@@ -1208,13 +1294,13 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			ASX -= NY;
 			ASX &= 1023; // mask to 10 bits range
 			if (ANX++ == NX || (ADX & Mode::PIXELS_PER_LINE)) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
 		addr = Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt);
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLine, checkCache(false, addr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLine, cache.check(false, addr));
 		goto loop;
 	}
 	default:
@@ -1358,9 +1444,10 @@ void VDPCmdEngine::startLmmvHs(EmuTime time)
 	ADX = DX;
 	ANX = tmpNX;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmmv, checkCache(false, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmmv, cache.check(false, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? (1 + 1) : (1 + 1 + waitLmmv + waitLmmv));
 	phase = 0;
+	calcReach<Mode>(tmpNY);
 }
 
 template<typename Mode, typename LogOp>
@@ -1384,7 +1471,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 		if (doPset) [[likely]] {
 			tmpDst = vram.cmdWriteWindow.readNP(addr);
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmv, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmv, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 		[[fallthrough]];
 	case 1: {
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
@@ -1397,13 +1484,13 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			DY += TY; --NY;
 			ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
 		addr = Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt);
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmv, checkCache(false, addr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmv, cache.check(false, addr));
 		goto loop;
 	}
 	default:
@@ -1574,9 +1661,10 @@ void VDPCmdEngine::startLmmmHs(EmuTime time)
 	ADX = DX;
 	ANX = tmpNX;
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmmm, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmmm, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? (1 + 1 + 1) : (1 + 1 + 1 + waitLmmm + waitLmmm + waitLmmm));
 	phase = 0;
+	calcReach<Mode>(tmpNY);
 }
 
 template<typename Mode, typename LogOp>
@@ -1604,14 +1692,14 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 		       tmpSrc = 0xFF;
 		}
 
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmm, checkCache(false, dstAddr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmm, cache.check(false, dstAddr));
 		[[fallthrough]];
 	case 1:
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
 		if (doPset) [[likely]] {
 			tmpDst = vram.cmdWriteWindow.readNP(dstAddr);
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmm, checkCache(true, dstAddr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmm, cache.check(true, dstAddr));
 		[[fallthrough]];
 	case 2: {
 		if (calculator.limitReached()) [[unlikely]] { phase = 2; break; }
@@ -1626,13 +1714,13 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			SY += TY; DY += TY; --NY;
 			ASX = SX; ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
 		dstAddr = Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt);
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmm, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLmmm, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
 		goto loop;
 	}
 	default:
@@ -1705,7 +1793,7 @@ void VDPCmdEngine::startLmcmHs(EmuTime time)
 	transfer = true;
 	status |= TR;
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmcm, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmcm, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
 	setStatusChangeTime(EmuTime::zero());
 }
 
@@ -1818,7 +1906,7 @@ void VDPCmdEngine::startLmmcHs(EmuTime time)
 	// Baltak Rampage: characters in greetings part are one pixel offset
 	status |= TR;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmmc, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLmmc, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 }
 
 template<typename Mode, typename LogOp>
@@ -1858,7 +1946,7 @@ void VDPCmdEngine::executeLmmcHs(EmuTime limit)
 			ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
 				auto calculator = getSlotCalculator(limit);
-				calculator.nextHs(0, 0, flushCache());
+				calculator.nextHs(0, 0, cache.flush());
 				commandDone(calculator.getTime());
 			}
 		}
@@ -1981,8 +2069,72 @@ void VDPCmdEngine::startHmmvHs(EmuTime time)
 	ADX = DX;
 	ANX = tmpNX;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitHmmv, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitHmmv, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? 1 : (1 + waitHmmv));
+	calcReach<Mode>(tmpNY);
+}
+
+/** Block-transfer fast path for HMMV in high-speed mode.
+  * Only used at the start of a line, when the command finishes before 'limit'
+  * and when no observed VRAM window overlaps with the destination. The timing
+  * (including the cache penalties) is replayed exactly like executeHmmvHs()
+  * does, only the VRAM writes are postponed and then done per line.
+  * @return true iff the command was completely executed.
+  */
+template<typename Mode>
+bool VDPCmdEngine::blockHmmvHs(EmuTime limit, unsigned tmpNX, unsigned tmpNY)
+{
+	if ((ADX != DX) || (ANX != tmpNX) || (DX >= Mode::PIXELS_PER_LINE) ||
+	    getMXD(ARG, vdp.hasEVR()) || (statusChangeTime > limit)) {
+		return false;
+	}
+	bool evr = vdp.isEVR();
+	int TX = (ARG & DIX)
+		? -Mode::PIXELS_PER_BYTE : Mode::PIXELS_PER_BYTE;
+	int TY = (ARG & DIY) ? -1 : 1;
+	unsigned left = getRowLeft<Mode>(DX, tmpNX, ARG);
+	unsigned y = DY;
+	for (unsigned n = tmpNY; n != 0; --n, y += TY) {
+		for (auto run : getRowRuns<Mode>(left, y, tmpNX, evr)) {
+			if (run.num && !vram.isCmdBlockWritable(run.addr, run.num)) return false;
+		}
+	}
+
+	auto savedCache = cache;
+	auto calculator = getSlotCalculator(limit);
+	int wait = vdp.isHS() ? 0 : waitHmmv;
+	unsigned adx = ADX;
+	unsigned dy = DY;
+	unsigned anx = ANX;
+	unsigned ny = tmpNY;
+	while (true) {
+		if (calculator.limitReached()) {
+			cache = savedCache;
+			return false;
+		}
+		adx += TX;
+		if (--anx == 0) {
+			dy += TY;
+			adx = DX; anx = tmpNX;
+			if (--ny == 0) break;
+		}
+		calculator.nextHs(1, wait, cache.check(true, Mode::addressOf(adx, dy, evr, false)));
+	}
+	EmuTime lastWrite = calculator.getTime();
+	calculator.nextHs(1, 0, cache.flush());
+
+	y = DY;
+	for (unsigned n = tmpNY; n != 0; --n, y += TY) {
+		for (auto run : getRowRuns<Mode>(left, y, tmpNX, evr)) {
+			if (run.num) vram.cmdFill(run.addr, run.num, COL, lastWrite);
+		}
+	}
+	DY = dy;
+	NY -= tmpNY;
+	ADX = DX; ANX = tmpNX;
+	engineTime = calculator.getTime();
+	commandDone(engineTime);
+	return true;
 }
 
 template<typename Mode>
@@ -1996,6 +2148,7 @@ void VDPCmdEngine::executeHmmvHs(EmuTime limit)
 	int TY = (ARG & DIY) ? -1 : 1;
 	ANX = clipNX_1_byte<Mode>(
 		ADX, ANX << Mode::PIXELS_PER_BYTE_SHIFT, ARG);
+	if (blockHmmvHs<Mode>(limit, tmpNX, tmpNY)) return;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
 	bool doPset = !dstExt || hasExtendedVRAM;
 	auto calculator = getSlotCalculator(limit);
@@ -2010,12 +2163,12 @@ void VDPCmdEngine::executeHmmvHs(EmuTime limit)
 			DY += TY; --NY;
 			ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitHmmv, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitHmmv, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 	}
 	engineTime = calculator.getTime();
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? 1 : (1 + waitHmmv));
@@ -2169,9 +2322,114 @@ void VDPCmdEngine::startHmmmHs(EmuTime time)
 	ADX = DX;
 	ANX = tmpNX;
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitHmmm, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitHmmm, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), srcExt)));
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? (1 + 1) : (1 + 1 + waitHmmm + waitHmmm));
 	phase = 0;
+	calcReach<Mode>(tmpNY);
+}
+
+/** Copy the lines of a HMMM/YMMM command with memmove(), see blockHmmmHs().
+  * Lines are copied in the same order as the per-byte loop does. Within a
+  * line the source and destination may not partially overlap, for such
+  * lines (or when the lines aren't accessible as a block) nothing is copied.
+  * @return true iff all lines can be (or, when 'doCopy', were) copied.
+  */
+template<typename Mode>
+static bool copyRows(VDPVRAM& vram, unsigned srcLeft, unsigned sy,
+                     unsigned dstLeft, unsigned dy, int TY,
+                     unsigned num, unsigned rows, bool evr,
+                     bool doCopy, EmuTime time)
+{
+	if constexpr (Mode::PLANAR) {
+		// even and odd bytes must end up in the same plane
+		if ((srcLeft ^ dstLeft) & 1) return false;
+	}
+	for (/**/; rows != 0; --rows, sy += TY, dy += TY) {
+		auto srcRuns = getRowRuns<Mode>(srcLeft, sy, num, evr);
+		auto dstRuns = getRowRuns<Mode>(dstLeft, dy, num, evr);
+		for (auto i : xrange(2)) {
+			auto src = srcRuns[i];
+			auto dst = dstRuns[i];
+			if (src.num == 0) continue;
+			if (doCopy) {
+				vram.cmdCopy(dst.addr, src.addr, src.num, time);
+				continue;
+			}
+			if (!vram.isCmdBlockReadable(src.addr, src.num) ||
+			    !vram.isCmdBlockWritable(dst.addr, dst.num)) {
+				return false;
+			}
+			for (auto d : dstRuns) {
+				if (d.num && overlaps(src, d) && (src.addr != d.addr)) {
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/** Block-transfer fast path for HMMM in high-speed mode.
+  * Same conditions as for blockHmmvHs(), and in addition the source may not
+  * use extended VRAM and a line may not partially overlap with itself.
+  * @return true iff the command was completely executed.
+  */
+template<typename Mode>
+bool VDPCmdEngine::blockHmmmHs(EmuTime limit, unsigned tmpNX, unsigned tmpNY)
+{
+	if ((phase != 0) || (ASX != SX) || (ADX != DX) || (ANX != tmpNX) ||
+	    (SX >= Mode::PIXELS_PER_LINE) || (DX >= Mode::PIXELS_PER_LINE) ||
+	    getMXS(ARG, vdp.hasEVR()) || getMXD(ARG, vdp.hasEVR()) ||
+	    (statusChangeTime > limit)) {
+		return false;
+	}
+	bool evr = vdp.isEVR();
+	int TX = (ARG & DIX)
+	       ? -Mode::PIXELS_PER_BYTE : Mode::PIXELS_PER_BYTE;
+	int TY = (ARG & DIY) ? -1 : 1;
+	unsigned srcLeft = getRowLeft<Mode>(SX, tmpNX, ARG);
+	unsigned dstLeft = getRowLeft<Mode>(DX, tmpNX, ARG);
+	if (!copyRows<Mode>(vram, srcLeft, SY, dstLeft, DY, TY, tmpNX, tmpNY, evr,
+	                    false, EmuTime::zero())) {
+		return false;
+	}
+
+	auto savedCache = cache;
+	auto calculator = getSlotCalculator(limit);
+	int wait = vdp.isHS() ? 0 : waitHmmm;
+	unsigned asx = ASX, adx = ADX;
+	unsigned sy = SY, dy = DY;
+	unsigned anx = ANX;
+	unsigned ny = tmpNY;
+	while (true) {
+		if (calculator.limitReached()) {
+			cache = savedCache;
+			return false;
+		}
+		calculator.nextHs(1, wait, cache.check(true, Mode::addressOf(adx, dy, evr, false)));
+		if (calculator.limitReached()) {
+			cache = savedCache;
+			return false;
+		}
+		asx += TX; adx += TX;
+		if (--anx == 0) {
+			sy += TY; dy += TY;
+			asx = SX; adx = DX; anx = tmpNX;
+			if (--ny == 0) break;
+		}
+		calculator.nextHs(1, wait, cache.check(false, Mode::addressOf(asx, sy, evr, false)));
+	}
+	EmuTime lastWrite = calculator.getTime();
+	calculator.nextHs(1, 0, cache.flush());
+
+	copyRows<Mode>(vram, srcLeft, SY, dstLeft, DY, TY, tmpNX, tmpNY, evr,
+	               true, lastWrite);
+	SY = sy; DY = dy;
+	NY -= tmpNY;
+	ASX = SX; ADX = DX; ANX = tmpNX;
+	engineTime = calculator.getTime();
+	commandDone(engineTime);
+	return true;
 }
 
 template<typename Mode>
@@ -2185,6 +2443,7 @@ void VDPCmdEngine::executeHmmmHs(EmuTime limit)
 	int TY = (ARG & DIY) ? -1 : 1;
 	ANX = clipNX_2_byte<Mode>(
 		ASX, ADX, ANX << Mode::PIXELS_PER_BYTE_SHIFT, ARG);
+	if (blockHmmmHs<Mode>(limit, tmpNX, tmpNY)) return;
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
 	bool dstExt  = getMXD(ARG, vdp.hasEVR());
 	bool doPoint = !srcExt || hasExtendedVRAM;
@@ -2199,7 +2458,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 		} else {
 			tmpSrc = 0xFF;
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitHmmm, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitHmmm, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 		[[fallthrough]];
 	case 1: {
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
@@ -2214,12 +2473,12 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			SY += TY; DY += TY; --NY;
 			ASX = SX; ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitHmmm, checkCache(false, Mode::addressOf(ASX, SY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitHmmm, cache.check(false, Mode::addressOf(ASX, SY, vdp.isEVR(), dstExt)));
 		goto loop;
 	}
 	default:
@@ -2369,9 +2628,70 @@ void VDPCmdEngine::startYmmmHs(EmuTime time)
 	ADX = DX;
 	ANX = tmpNX;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitYmmm, checkCache(false, Mode::addressOf(ADX, SY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitYmmm, cache.check(false, Mode::addressOf(ADX, SY, vdp.isEVR(), dstExt)));
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? (1 + 1) : (1 + 1 + waitYmmm + waitYmmm));
 	phase = 0;
+	calcReach<Mode>(tmpNY);
+}
+
+/** Block-transfer fast path for YMMM in high-speed mode.
+  * Same conditions as for blockHmmmHs().
+  * @return true iff the command was completely executed.
+  */
+template<typename Mode>
+bool VDPCmdEngine::blockYmmmHs(EmuTime limit, unsigned tmpNX, unsigned tmpNY)
+{
+	if ((phase != 0) || (ADX != DX) || (ANX != tmpNX) ||
+	    (DX >= Mode::PIXELS_PER_LINE) || getMXD(ARG, vdp.hasEVR()) ||
+	    (statusChangeTime > limit)) {
+		return false;
+	}
+	bool evr = vdp.isEVR();
+	int TX = (ARG & DIX)
+		? -Mode::PIXELS_PER_BYTE : Mode::PIXELS_PER_BYTE;
+	int TY = (ARG & DIY) ? -1 : 1;
+	unsigned left = getRowLeft<Mode>(DX, tmpNX, ARG);
+	if (!copyRows<Mode>(vram, left, SY, left, DY, TY, tmpNX, tmpNY, evr,
+	                    false, EmuTime::zero())) {
+		return false;
+	}
+
+	auto savedCache = cache;
+	auto calculator = getSlotCalculator(limit);
+	int wait = vdp.isHS() ? 0 : waitYmmm;
+	unsigned adx = ADX;
+	unsigned sy = SY, dy = DY;
+	unsigned anx = ANX;
+	unsigned ny = tmpNY;
+	while (true) {
+		if (calculator.limitReached()) {
+			cache = savedCache;
+			return false;
+		}
+		calculator.nextHs(1, wait, cache.check(true, Mode::addressOf(adx, dy, evr, false)));
+		if (calculator.limitReached()) {
+			cache = savedCache;
+			return false;
+		}
+		adx += TX;
+		if (--anx == 0) {
+			sy += TY; dy += TY;
+			adx = DX; anx = tmpNX;
+			if (--ny == 0) break;
+		}
+		calculator.nextHs(1, wait, cache.check(false, Mode::addressOf(adx, sy, evr, false)));
+	}
+	EmuTime lastWrite = calculator.getTime();
+	calculator.nextHs(1, 0, cache.flush());
+
+	copyRows<Mode>(vram, left, SY, left, DY, TY, tmpNX, tmpNY, evr,
+	               true, lastWrite);
+	SY = sy; DY = dy;
+	NY -= tmpNY;
+	ADX = DX; ANX = tmpNX;
+	engineTime = calculator.getTime();
+	commandDone(engineTime);
+	return true;
 }
 
 template<typename Mode>
@@ -2385,6 +2705,7 @@ void VDPCmdEngine::executeYmmmHs(EmuTime limit)
 		? -Mode::PIXELS_PER_BYTE : Mode::PIXELS_PER_BYTE;
 	int TY = (ARG & DIY) ? -1 : 1;
 	ANX = clipNX_1_byte<Mode>(ADX, 512, ARG);
+	if (blockYmmmHs<Mode>(limit, tmpNX, tmpNY)) return;
 
 	// TODO does this use MXD for both read and write?
 	//  it says so in the datasheet, but it seems illogical
@@ -2400,7 +2721,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			tmpSrc = vram.cmdReadWindow.readNP(
 			       Mode::addressOf(ADX, SY, vdp.isEVR(), dstExt));
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitYmmm, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitYmmm, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 		[[fallthrough]];
 	case 1:
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
@@ -2414,12 +2735,12 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			SY += TY; DY += TY; --NY;
 			ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
-				calculator.nextHs(1, 0, flushCache());
+				calculator.nextHs(1, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitYmmm, checkCache(false, Mode::addressOf(ADX, SY, vdp.isEVR(), dstExt)));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitYmmm, cache.check(false, Mode::addressOf(ADX, SY, vdp.isEVR(), dstExt)));
 		goto loop;
 	default:
 		UNREACHABLE;
@@ -2494,7 +2815,7 @@ void VDPCmdEngine::startHmmcHs(EmuTime time)
 	// do not set 'transfer = true', see startLmmc()
 	status |= TR;
 	bool dstExt = getMXD(ARG, vdp.hasEVR());
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitHmmc, checkCache(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitHmmc, cache.check(true, Mode::addressOf(ADX, DY, vdp.isEVR(), dstExt)));
 }
 
 template<typename Mode>
@@ -2527,7 +2848,7 @@ void VDPCmdEngine::executeHmmcHs(EmuTime limit)
 			ADX = DX; ANX = tmpNX;
 			if (--tmpNY == 0) {
 				auto calculator = getSlotCalculator(limit);
-				calculator.nextHs(0, 0, flushCache());
+				calculator.nextHs(0, 0, cache.flush());
 				commandDone(calculator.getTime());
 			}
 		}
@@ -2643,7 +2964,7 @@ void VDPCmdEngine::startLfmmHs(EmuTime time)
 	ANY = tmpNY;
 	bool srcExt  = getMXS(ARG, vdp.hasEVR());
 	fontWidthCount = 0;
-	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLfmm, checkCache(false, ASA));
+	nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLfmm, cache.check(false, ASA));
 	calcFinishTime(tmpNX, tmpNY, vdp.isHS() ? (1 + 1 + 1) : (1 + 1 + 1 + waitLfmm + waitLfmm + waitLfmm));
 	phase = 0;
 }
@@ -2669,14 +2990,14 @@ loop:	if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			tmpSrc = vram.cmdReadWindow.readNP(ASA++);
 			fontWidthCount = 8;
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLfmm, checkCache(false, dstAddr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLfmm, cache.check(false, dstAddr));
 		[[fallthrough]];
 	case 1:
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
 		if (doPset) [[likely]] {
 			tmpDst = vram.cmdWriteWindow.readNP(dstAddr);
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLfmm, checkCache(true, dstAddr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLfmm, cache.check(true, dstAddr));
 		[[fallthrough]];
 	case 2: {
 		if (calculator.limitReached()) [[unlikely]] { phase = 2; break; }
@@ -2706,14 +3027,14 @@ loop:	if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			ADX = DX;
 			ANX = tmpNX;
 			if (tmpNX <= 0) {
-				calculator.nextHs(0, 0, flushCache());
+				calculator.nextHs(0, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
 		}
 		dstAddr = Mode::addressOf(ADX, ADY, vdp.isEVR(), dstExt);
 		if (fontWidthCount <= 0) {
-			calculator.nextHs(1, vdp.isHS() ? 0 : waitLfmm, checkCache(false, ASA));
+			calculator.nextHs(1, vdp.isHS() ? 0 : waitLfmm, cache.check(false, ASA));
 		}
 		goto loop;
 	}
@@ -2917,7 +3238,7 @@ void VDPCmdEngine::startLrmmHs(EmuTime time)
 	signed x = (signed)ASX_12P8 / 256;
 	signed y = (signed)ASY_12P8 / 256;
 	if ((signed)WSX <= x && x <= (signed)WEX && (signed)WSY <= y && y <= (signed)WEY) {
-		nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLrmm, checkCache(false, Mode::addressOf(x, y, vdp.isEVR(), srcExt)));
+		nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLrmm, cache.check(false, Mode::addressOf(x, y, vdp.isEVR(), srcExt)));
 	} else {
 		nextAccessSlotHs(time, 1, vdp.isHS() ? 0 : waitLrmm, VDPCmdCache::CachePenalty::CACHE_NONE);
 	}
@@ -2956,14 +3277,14 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 		} else {
 		       tmpSrc = 0xFF;
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, checkCache(false, dstAddr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, cache.check(false, dstAddr));
 		[[fallthrough]];
 	case 1:
 		if (calculator.limitReached()) [[unlikely]] { phase = 1; break; }
 		if (doPset) [[likely]] {
 			tmpDst = vram.cmdWriteWindow.readNP(dstAddr);
 		}
-		calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, checkCache(true, dstAddr));
+		calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, cache.check(true, dstAddr));
 		[[fallthrough]];
 	case 2: {
 		if (calculator.limitReached()) [[unlikely]] { phase = 2; break; }
@@ -2988,7 +3309,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 			ADX = DX;
 			ANX = tmpNX;
 			if (--tmpNY == 0) {
-				calculator.nextHs(0, 0, flushCache());
+				calculator.nextHs(0, 0, cache.flush());
 				commandDone(calculator.getTime());
 				break;
 			}
@@ -2998,7 +3319,7 @@ loop:		if (calculator.limitReached()) [[unlikely]] { phase = 0; break; }
 		x = ASX_12P8 / 256;
 		y = (ARG & XHR) ? (ASY_12P8 / 512) : (ASY_12P8 / 256);
 		if ((signed)WSX <= x && x <= (signed)WEX && (signed)WSY <= y && y <= (signed)WEY) {
-			calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, checkCache(false, Mode::addressOf(x, y, vdp.isEVR(), srcExt)));
+			calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, cache.check(false, Mode::addressOf(x, y, vdp.isEVR(), srcExt)));
 		} else {
 			calculator.nextHs(1, vdp.isHS() ? 0 : waitLrmm, VDPCmdCache::CachePenalty::CACHE_NONE);
 		}
@@ -3017,6 +3338,16 @@ VDPCmdEngine::VDPCmdEngine(VDP& vdp_, CommandController& commandController)
 		commandController, vdp_.getName() == "VDP" ? "vdpcmdtrace" :
 		vdp_.getName() + " vdpcmdtrace", "VDP command tracing on/off",
 		false)
+	, cmdLazySetting(
+		commandController, vdp_.getName() == "VDP" ? "vdpcmdlazy" :
+		vdp_.getName() + " vdpcmdlazy",
+		"Defer execution of high-speed VDP block commands until their "
+		"result is observed", false)
+	, cmdProfileSetting(
+		commandController, vdp_.getName() == "VDP" ? "vdpcmdprofile" :
+		vdp_.getName() + " vdpcmdprofile",
+		"Record the timing of each VDP command, see the 'vdpcmdprofile' "
+		"command", false)
 	, cmdInProgressCallback(
 		commandController, vdp_.getName() == "VDP" ?
 		"vdpcmdinprogress_callback" : vdp_.getName() +
@@ -3030,6 +3361,8 @@ VDPCmdEngine::VDPCmdEngine(VDP& vdp_, CommandController& commandController)
 		strCat(vdp.getName(), '.', "commandExecuting"),
 		"Is the V99x8 VDP is currently executing a command",
 		false)
+	, cacheStatsDebug(vdp_)
+	, profileCmd(commandController, vdp_)
 	, hasExtendedVRAM(vram.getSize() == (192 * 1024))
 {
 }
@@ -3047,8 +3380,7 @@ void VDPCmdEngine::reset(EmuTime time)
 	WEX = 0x1FF;
 	WEY = 0x7FF;
 
-	cachePriority = 0;
-	for (auto& cb : cacheBuffer) cb.data_en = false;
+	cache.reset();
 
 	updateDisplayMode(vdp.getDisplayMode(), vdp.getCmdBit(), time);
 }
@@ -3236,6 +3568,7 @@ void VDPCmdEngine::updateDisplayMode(DisplayMode mode, bool cmdBit, EmuTime time
 
 	if (newScrMode != scrMode) {
 		sync(time);
+		deferrable = false; // reach was calculated for the old mode
 		if (CMD) {
 			// VDP mode switch while command in progress
 			if (newScrMode == -1) {
@@ -3271,6 +3604,9 @@ void VDPCmdEngine::executeCommand(EmuTime time)
 	if (cmdTraceSetting.getBoolean()) {
 		reportVdpCommand();
 	}
+	if (cmdProfileSetting.getBoolean()) [[unlikely]] {
+		profileCommand(time);
+	}
 
 	// Start command.
 	status |= CE;
@@ -4079,10 +4415,15 @@ void VDPCmdEngine::executeCommandHs(EmuTime time)
 	if (cmdTraceSetting.getBoolean()) {
 		reportVdpCommand();
 	}
+	if (cmdProfileSetting.getBoolean()) [[unlikely]] {
+		profileCommand(time);
+	}
 
 	// Start command.
 	status |= CE;
 	executingProbe = true;
+	deferrable = false; // set by calcReach() for block commands
+	cache.setCommand(CMD >> 4);
 
 	switch ((tmpScrMode << 4) | (CMD >> 4)) {
 	case 0x00: case 0x10: case 0x20: case 0x30: case 0x40:
@@ -4880,16 +5221,114 @@ void VDPCmdEngine::sync2Hs(EmuTime time)
 	}
 }
 
+VDPCmdEngine::CacheStatsDebug::CacheStatsDebug(const VDP& vdp)
+	: SimpleDebuggable(vdp.getMotherBoard(), vdp.getName() + " cmd cache stats",
+	                   "High-speed VDP command cache counters: for each command "
+	                   "6 32-bit little endian values (read hit/miss/flush, "
+	                   "write hit/miss/flush). Writable, e.g. to reset them.",
+	                   VDPCmdCache::NUM_COMMANDS * VDPCmdCache::NUM_STATS * 4)
+{
+}
+
+uint8_t VDPCmdEngine::CacheStatsDebug::read(unsigned address)
+{
+	const auto& engine = OUTER(VDPCmdEngine, cacheStatsDebug);
+	const auto& counters = engine.getCacheCounters();
+	auto value = counters[address / (4 * VDPCmdCache::NUM_STATS)]
+	                     [(address / 4) % VDPCmdCache::NUM_STATS];
+	return narrow_cast<uint8_t>(value >> (8 * (address % 4)));
+}
+
+void VDPCmdEngine::CacheStatsDebug::write(unsigned address, uint8_t value)
+{
+	auto& engine = OUTER(VDPCmdEngine, cacheStatsDebug);
+	auto& counter = engine.cache.getCounters()
+		[address / (4 * VDPCmdCache::NUM_STATS)]
+		[(address / 4) % VDPCmdCache::NUM_STATS];
+	unsigned shift = 8 * (address % 4);
+	counter = (counter & ~(0xFFu << shift)) | (uint32_t(value) << shift);
+}
+
+static constexpr std::array<std::string_view, 16> COMMANDS = {
+	" ABRT"," ????"," ????"," ????","POINT"," PSET"," SRCH"," LINE",
+	" LMMV"," LMMM"," LMCM"," LMMC"," HMMV"," HMMM"," YMMM"," HMMC"
+};
+static constexpr std::array<std::string_view, 16> OPS = {
+	"IMP ","AND ","OR  ","XOR ","NOT ","NOP ","NOP ","NOP ",
+	"TIMP","TAND","TOR ","TXOR","TNOT","NOP ","NOP ","NOP "
+};
+
+[[nodiscard]] static std::string_view trimmed(std::string_view s)
+{
+	while (s.starts_with(' ')) s.remove_prefix(1);
+	while (s.ends_with(' ')) s.remove_suffix(1);
+	return s;
+}
+
+VDPCmdEngine::ProfileCmd::ProfileCmd(CommandController& commandController_, const VDP& vdp)
+	: Command(commandController_, vdp.getName() == "VDP" ? "vdpcmdprofile" :
+	          vdp.getName() + " vdpcmdprofile")
+{
+}
+
+void VDPCmdEngine::ProfileCmd::execute(std::span<const TclObject> tokens, TclObject& result)
+{
+	checkNumArgs(tokens, 2, "subcommand");
+	auto& engine = OUTER(VDPCmdEngine, profileCmd);
+	const auto& profiler = engine.getProfiler();
+	executeSubCommand(tokens[1].getString(),
+		"list", [&]{
+			auto seconds = [](EmuTime t) { return (t - EmuTime::zero()).toDouble(); };
+			result = TclObject(TclObject::MakeListTag{});
+			for (auto i : xrange(profiler.size())) {
+				const auto& r = profiler[i];
+				result.addListElement(makeTclDict(
+					"cmd", trimmed(COMMANDS[r.cmd]),
+					"logop", trimmed(OPS[r.logOp]),
+					"nx", r.nx,
+					"ny", r.ny,
+					"hs", r.hs,
+					"start", seconds(r.start),
+					"finish", r.inProgress() ? TclObject() : TclObject(seconds(r.finish)),
+					"aborted", r.aborted,
+					"stalls", r.stalls,
+					"cache", makeTclList(r.cache[0], r.cache[1], r.cache[2],
+					                     r.cache[3], r.cache[4], r.cache[5])));
+			}
+		},
+		"size",  [&]{ result = narrow<int>(profiler.size()); },
+		"clear", [&]{ engine.clearProfiler(); });
+}
+
+std::string VDPCmdEngine::ProfileCmd::help(std::span<const TclObject> /*tokens*/) const
+{
+	return "Access the VDP commands that were recorded while the "
+	       "'vdpcmdprofile' setting was enabled (at most 4096).\n"
+	       "  vdpcmdprofile list   returns a list of dicts, oldest first, with keys:\n"
+	       "                       cmd logop nx ny hs start finish (in seconds, empty\n"
+	       "                       while in progress) aborted stalls (access slots\n"
+	       "                       stolen by the CPU) and cache (read hit/miss/flush,\n"
+	       "                       write hit/miss/flush of the high-speed cache)\n"
+	       "  vdpcmdprofile size   returns the number of recorded commands\n"
+	       "  vdpcmdprofile clear  removes all recorded commands\n";
+}
+
+void VDPCmdEngine::ProfileCmd::tabCompletion(std::vector<std::string>& tokens) const
+{
+	using namespace std::literals;
+	static constexpr std::array cmds = {"list"sv, "size"sv, "clear"sv};
+	if (tokens.size() == 2) {
+		completeString(tokens, cmds);
+	}
+}
+
+void VDPCmdEngine::profileCommand(EmuTime time)
+{
+	profiler.begin(CMD, NX, NY, vdp.useHS(), stolenSlots, cache.getCounters(), time);
+}
+
 void VDPCmdEngine::reportVdpCommand() const
 {
-	static constexpr std::array<std::string_view, 16> COMMANDS = {
-		" ABRT"," ????"," ????"," ????","POINT"," PSET"," SRCH"," LINE",
-		" LMMV"," LMMM"," LMCM"," LMMC"," HMMV"," HMMM"," YMMM"," HMMC"
-	};
-	static constexpr std::array<std::string_view, 16> OPS = {
-		"IMP ","AND ","OR  ","XOR ","NOT ","NOP ","NOP ","NOP ",
-		"TIMP","TAND","TOR ","TXOR","TNOT","NOP ","NOP ","NOP "
-	};
 
 	std::cerr << "VDPCmd " << COMMANDS[CMD >> 4] << '-' << OPS[CMD & 15]
 		<<  '(' << int(SX) << ',' << int(SY) << ")->("
@@ -4904,6 +5343,10 @@ void VDPCmdEngine::commandDone(EmuTime time)
 	status &= ~CE;
 	executingProbe = false;
 	CMD = 0;
+	deferrable = false;
+	if (profiler.isOpen()) [[unlikely]] {
+		profiler.end(stolenSlots, cache.getCounters(), time);
+	}
 	setStatusChangeTime(EmuTime::infinity());
 	vram.cmdReadWindow.disable(time);
 	vram.cmdWriteWindow.disable(time);
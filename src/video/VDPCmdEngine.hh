@@ -4,13 +4,20 @@
 #include "VDP.hh"
 #include "VDPAccessSlots.hh"
 #include "VDPCmdCache.hh"
+#include "VDPCmdProfiler.hh"
 
 #include "BooleanSetting.hh"
+#include "Command.hh"
+#include "HostTimeProfile.hh"
 #include "Probe.hh"
+#include "SimpleDebuggable.hh"
 #include "TclCallback.hh"
 #include "serialize_meta.hh"
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <iterator>
 
 namespace openmsx {
 
@@ -55,6 +62,13 @@ public:
 	static constexpr int waitLfmc = 0;
 	static constexpr int waitLrmm = 0;
 
+	/** A contiguous range in VRAM.
+	  */
+	struct VRAMRun {
+		unsigned addr;
+		unsigned num;
+	};
+
 public:
 	VDPCmdEngine(VDP& vdp, CommandController& commandController);
 
@@ -70,6 +84,7 @@ public:
 	  */
 	void sync(EmuTime time) {
 		if (CMD) {
+			HostTimeProfile::Scope profile(HostTimeProfile::Category::VDP_CMD);
 			if (vdp.useHS()) {
 				sync2Hs(time);
 			} else {
@@ -80,12 +95,28 @@ public:
 	void sync2(EmuTime time);
 	void sync2Hs(EmuTime time);
 
+	/** Like sync(), but meant for subsystems that only look at (a part
+	  * of) VRAM, like the renderer and the sprite checker. In lazy mode
+	  * ('vdpcmdlazy' setting) the execution of a high-speed block command
+	  * is deferred as long as its destination doesn't overlap with a VRAM
+	  * window that is observed by such a subsystem. Other observers (CPU
+	  * VRAM access, status registers, command register writes) still use
+	  * sync(), that way many small syncs get batched into one.
+	  * @param time The moment in emulated time to sync to.
+	  */
+	void syncObserved(EmuTime time) {
+		if (!deferrable || isReachObserved()) {
+			sync(time);
+		}
+	}
+
 	/** Steal a VRAM access slot from the CmdEngine.
 	 * Used when the CPU reads/writes VRAM.
 	 * @param time The moment in time the CPU read/write is performed.
 	 */
 	void stealAccessSlot(EmuTime time) {
 		if (CMD && engineTime <= time) {
+			++stolenSlots;
 			// take the next available slot
 			engineTime = getNextAccessSlot(time, VDPAccessSlots::Delta::D1);
 			assert(engineTime > time);
@@ -181,118 +212,27 @@ public:
 		                     : std::tuple{-1, -1, -1, -1};
 	}
 
+	/** Number of high-speed cache accesses per command, indexed by
+	  * [CMD >> 4][VDPCmdCache::Stat]. Counting starts at power-up.
+	  */
+	[[nodiscard]] const VDPCmdCache::Counters& getCacheCounters() const {
+		return cache.getCounters();
+	}
+	void resetCacheCounters() { cache.resetCounters(); }
+
+	/** The most recently executed commands, only recorded while the
+	  * 'vdpcmdprofile' setting is enabled.
+	  */
+	[[nodiscard]] const VDPCmdProfiler& getProfiler() const { return profiler; }
+	void clearProfiler() { profiler.clear(); }
+	[[nodiscard]] BooleanSetting& getProfileSetting() { return cmdProfileSetting; }
+
 	/** Interface for logical operations.
 	  */
 	template<typename Archive>
 	void serialize(Archive& ar, unsigned version);
 
 private:
-	static constexpr int CACHE_BUFFER_COUNT = 4;
-
-	struct CacheBuffer {
-		bool		data_en;
-		bool		already_read;
-		bool		data_mask[4];
-		unsigned	address;
-	};
-
-	VDPCmdCache::CachePenalty flushCache()
-	{
-		int cnt = 0;
-		for (auto& cb : cacheBuffer) {
-			if (cb.data_en && !(cb.data_mask[0] & cb.data_mask[1] & cb.data_mask[2] & cb.data_mask[3])) {
-				cb.data_en = false;
-				cb.data_mask[0] = true;
-				cb.data_mask[1] = true;
-				cb.data_mask[2] = true;
-				cb.data_mask[3] = true;
-				cnt++;
-			}
-		}
-
-		switch (cnt) {
-		case 1:
-			return VDPCmdCache::CachePenalty::CACHE_FLUSH_1;
-		case 2:
-			return VDPCmdCache::CachePenalty::CACHE_FLUSH_2;
-		case 3:
-			return VDPCmdCache::CachePenalty::CACHE_FLUSH_3;
-		case 4:
-			return VDPCmdCache::CachePenalty::CACHE_FLUSH_4;
-		default:
-			return VDPCmdCache::CachePenalty::CACHE_FLUSH_0;
-		}
-	}
-
-	VDPCmdCache::CachePenalty checkCache(bool write, unsigned addr)
-	{
-		unsigned word_address = addr >> 2;
-		unsigned word_offset = addr & 3;
-		CacheBuffer *cb_ptr = &cacheBuffer[cachePriority];
-		bool found_free = false;
-
-		if (write) {
-			for (auto& cb : cacheBuffer) {
-				if (cb.data_en && cb.address == word_address) {
-					cb.data_mask[word_offset] = false;
-					//cb.data[word_offset] = w_data;
-					return VDPCmdCache::CachePenalty::CACHE_WRITE_HIT;
-				}
-			}
-
-			for (auto& cb : cacheBuffer) {
-				if (!cb.data_en) {
-					found_free = true;
-					cb_ptr = &cb;
-					break;
-				}
-			}
-		} else {
-			for (auto& cb : cacheBuffer) {
-				if (cb.data_en && cb.address == word_address) {
-					if (cb.already_read || !cb.data_mask[word_offset]) {
-						// r_data = cb.data[word_offset];
-						return VDPCmdCache::CachePenalty::CACHE_READ_HIT;
-					}
-				}
-			}
-		}
-
-		// flush
-		if (!found_free) {
-			if (cb_ptr->data_en && !(cb_ptr->data_mask[0] & cb_ptr->data_mask[1] & cb_ptr->data_mask[2] & cb_ptr->data_mask[3])) {
-				//write_32bis(cb_ptr->address, (uint32_t)cb_ptr->data[0] | ((uint32_t)cb_ptr->data[1] << 8) | ((uint32_t)cb_ptr->data[2] << 16) | ((uint32_t)cb_ptr->data[3] << 24), cb_ptr->data_mask)
-				cb_ptr->data_en = false;
-			}
-			cachePriority = (cachePriority + 1) % CACHE_BUFFER_COUNT;
-		}
-
-		// make new buffer
-		cb_ptr->data_en = true;
-		cb_ptr->already_read = !write;
-		cb_ptr->data_mask[0] = !write || !(word_offset == 0);
-		cb_ptr->data_mask[1] = !write || !(word_offset == 1);
-		cb_ptr->data_mask[2] = !write || !(word_offset == 2);
-		cb_ptr->data_mask[3] = !write || !(word_offset == 3);
-		cb_ptr->address = word_address;
-		//if(write) {
-		//	cb_ptr->data[offset] = w_data;
-		//} else {
-		//	uint32_t data = read_32bis(cb_ptr->address);
-		//	cb_ptr->data[0] = data & 0xFF;
-		//	cb_ptr->data[1] = (data >> 8) & 0xFF;
-		//	cb_ptr->data[2] = (data >> 16) & 0xFF;
-		//	cb_ptr->data[3] = (data >> 24) & 0xFF;
-		//	r_dara = cb_ptr->data[word_offset];
-		//}
-
-		if (write) {
-			return found_free ? VDPCmdCache::CachePenalty::CACHE_WRITE_MISS : VDPCmdCache::CachePenalty::CACHE_WRITE_FLUSH;
-		} else {
-			return found_free ? VDPCmdCache::CachePenalty::CACHE_READ_MISS : VDPCmdCache::CachePenalty::CACHE_READ_FLUSH;
-		}
-	}
-
 	void executeCommand(EmuTime time);
 	void executeCommandHs(EmuTime time);
 
@@ -364,6 +304,13 @@ private:
 	template<typename Mode, typename LogOp> void executeLfmmHs(EmuTime limit);
 	template<typename Mode, typename LogOp> void executeLrmmHs(EmuTime limit);
 
+	template<typename Mode> void calcReach(unsigned tmpNY);
+	[[nodiscard]] bool isReachObserved() const;
+
+	template<typename Mode> bool blockHmmvHs(EmuTime limit, unsigned tmpNX, unsigned tmpNY);
+	template<typename Mode> bool blockHmmmHs(EmuTime limit, unsigned tmpNX, unsigned tmpNY);
+	template<typename Mode> bool blockYmmmHs(EmuTime limit, unsigned tmpNX, unsigned tmpNY);
+
 	// Advance to the next access slot at or past the given time.
 	EmuTime getNextAccessSlot(EmuTime time) const {
 		return vdp.getAccessSlot(time, VDPAccessSlots::Delta::D0);
@@ -401,9 +348,14 @@ private:
 	  */
 	void reportVdpCommand() const;
 
+	/** Start a new record in the profiler, only called when profiling.
+	  */
+	void profileCommand(EmuTime time);
+
 private:
-	int cachePriority;
-	CacheBuffer cacheBuffer[CACHE_BUFFER_COUNT];
+	/** Cache between the high-speed command engine and VRAM.
+	  */
+	VDPCmdCache::Cache cache;
 
 	/** The VDP this command engine is part of.
 	  */
@@ -413,10 +365,44 @@ private:
 	/** Only call reportVdpCommand() when this setting is turned on
 	  */
 	BooleanSetting cmdTraceSetting;
+
+	/** Defer high-speed block commands until their result is observed,
+	  * see syncObserved().
+	  */
+	BooleanSetting cmdLazySetting;
+
+	/** Record the executed commands in 'profiler'.
+	  */
+	BooleanSetting cmdProfileSetting;
+
 	TclCallback cmdInProgressCallback;
 
 	Probe<bool> executingProbe;
 
+	/** Exposes the cache counters, see getCacheCounters().
+	  */
+	struct CacheStatsDebug final : SimpleDebuggable {
+		explicit CacheStatsDebug(const VDP& vdp);
+		[[nodiscard]] uint8_t read(unsigned address) override;
+		void write(unsigned address, uint8_t value) override;
+	} cacheStatsDebug;
+
+	/** Tcl access to the recorded commands, see getProfiler().
+	  */
+	struct ProfileCmd final : Command {
+		ProfileCmd(CommandController& commandController, const VDP& vdp);
+		void execute(std::span<const TclObject> tokens, TclObject& result) override;
+		[[nodiscard]] std::string help(std::span<const TclObject> tokens) const override;
+		void tabCompletion(std::vector<std::string>& tokens) const override;
+	} profileCmd;
+
+	VDPCmdProfiler profiler;
+
+	/** Number of access slots stolen by the CPU, see stealAccessSlot().
+	  * Only the difference between two moments is meaningful.
+	  */
+	uint32_t stolenSlots{0};
+
 	/** Time at which the next vram access slot is available.
 	  * Only valid when a command is executing.
 	  */
@@ -481,6 +467,16 @@ private:
 	  */
 	bool transfer{false};
 
+	/** The (conservative) VRAM area written by the current command, only
+	  * valid when 'deferrable' is set. See calcReach().
+	  */
+	std::array<VRAMRun, 2> reach{};
+
+	/** Can the execution of the current command be deferred until its
+	  * destination is observed? See syncObserved().
+	  */
+	bool deferrable{false};
+
 	/** Flag that indicated whether extended VRAM is available
 	 */
 	const bool hasExtendedVRAM;
@@ -0,0 +1,141 @@
+#ifndef VDPCMDPROFILER_HH
+#define VDPCMDPROFILER_HH
+
+#include "VDPCmdCache.hh"
+
+#include "EmuTime.hh"
+#include "xrange.hh"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace openmsx {
+
+/** Timing information of one VDP command, see VDPCmdProfiler.
+  */
+struct VDPCmdProfileRecord {
+	EmuTime start = EmuTime::zero();
+	EmuTime finish = EmuTime::infinity(); // infinity while in progress
+	unsigned nx = 0;
+	unsigned ny = 0;
+	uint32_t stalls = 0; // access slots stolen by CPU VRAM accesses
+	std::array<uint32_t, VDPCmdCache::NUM_STATS> cache = {}; // indexed by VDPCmdCache::Stat
+	uint8_t cmd = 0;   // upper nibble of the CMD register
+	uint8_t logOp = 0; // lower nibble of the CMD register
+	bool hs = false;   // executed by the high-speed command engine
+	bool aborted = false; // interrupted by the next command
+
+	[[nodiscard]] bool inProgress() const { return finish == EmuTime::infinity(); }
+};
+
+/** Records the most recent VDP commands in a ring buffer. Meant for
+  * debugging and tuning, the VDPCmdEngine only calls this when profiling
+  * is enabled (or when a recorded command is still in progress).
+  */
+class VDPCmdProfiler
+{
+public:
+	static constexpr size_t CAPACITY = 4096;
+
+	/** A command starts. If the previous command is still in progress, it
+	  * was interrupted at this time.
+	  * @param CMD The value of the CMD register.
+	  * @param nx,ny The size of the command.
+	  * @param hs Is the command executed by the high-speed engine?
+	  * @param stalls The current value of the stolen access slot counter.
+	  * @param counters The current values of the cache counters.
+	  * @param time The moment the command starts.
+	  */
+	void begin(uint8_t CMD, unsigned nx, unsigned ny, bool hs, uint32_t stalls,
+	           const VDPCmdCache::Counters& counters, EmuTime time) {
+		if (open) end(stalls, counters, time, true);
+		if (records.empty()) records.resize(CAPACITY);
+
+		auto& r = records[(head + count) % CAPACITY];
+		if (count == CAPACITY) {
+			head = (head + 1) % CAPACITY; // drop the oldest record
+		} else {
+			++count;
+		}
+		r = VDPCmdProfileRecord{};
+		r.start = time;
+		r.nx = nx;
+		r.ny = ny;
+		r.cmd = CMD >> 4;
+		r.logOp = CMD & 0x0F;
+		r.hs = hs;
+		startStalls = stalls;
+		startCache = counters[r.cmd];
+		open = true;
+	}
+
+	/** The command that was started with begin() is finished.
+	  * @param stalls The current value of the stolen access slot counter.
+	  * @param counters The current values of the cache counters.
+	  * @param time The moment the command finished.
+	  * @param aborted Was the command interrupted?
+	  */
+	void end(uint32_t stalls, const VDPCmdCache::Counters& counters,
+	         EmuTime time, bool aborted = false) {
+		assert(open);
+		auto& r = last();
+		r.finish = time;
+		r.aborted = aborted;
+		r.stalls = stalls - startStalls;
+		for (auto i : xrange(VDPCmdCache::NUM_STATS)) {
+			r.cache[i] = counters[r.cmd][i] - startCache[i];
+		}
+		open = false;
+	}
+
+	/** Is there a command in progress (started with begin())?
+	  */
+	[[nodiscard]] bool isOpen() const { return open; }
+
+	/** Remove all records (except the one in progress).
+	  */
+	void clear() {
+		if (open) {
+			head = (head + count - 1) % CAPACITY;
+			count = 1;
+		} else {
+			head = 0;
+			count = 0;
+		}
+	}
+
+	/** The number of records, at most CAPACITY.
+	  */
+	[[nodiscard]] size_t size() const { return count; }
+	[[nodiscard]] bool empty() const { return count == 0; }
+
+	/** The recorded commands, ordered from oldest to most recent.
+	  */
+	[[nodiscard]] const VDPCmdProfileRecord& operator[](size_t i) const {
+		assert(i < count);
+		return records[(head + i) % CAPACITY];
+	}
+	[[nodiscard]] const VDPCmdProfileRecord& back() const {
+		return (*this)[count - 1];
+	}
+
+private:
+	[[nodiscard]] VDPCmdProfileRecord& last() {
+		assert(count != 0);
+		return records[(head + count - 1) % CAPACITY];
+	}
+
+private:
+	std::vector<VDPCmdProfileRecord> records; // allocated on first use
+	size_t head = 0;  // index of the oldest record
+	size_t count = 0; // number of valid records
+	std::array<uint32_t, VDPCmdCache::NUM_STATS> startCache = {};
+	uint32_t startStalls = 0;
+	bool open = false;
+};
+
+} // namespace openmsx
+
+#endif
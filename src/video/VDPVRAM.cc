@@ -110,6 +110,7 @@ static constexpr unsigned bufferSize(unsigned size)
 VDPVRAM::VDPVRAM(VDP& vdp_, unsigned size, EmuTime time)
 	: vdp(vdp_)
 	, data(*vdp_.getDeviceConfig2().getXML(), bufferSize(size))
+	, dirty(bufferSize(size))
 	, logicalVRAMDebug (vdp)
 	, physicalVRAMDebug(vdp, size)
 	, actualSize(size)
@@ -137,6 +138,7 @@ void VDPVRAM::clear()
 {
 	// Initialise VRAM data array.
 	data.clear(0); // fill with zeros (unless initialContent is specified)
+	dirty.setAll();
 	if (data.size() != actualSize) {
 		assert(data.size() > actualSize);
 		// Read from unconnected VRAM returns random data.
@@ -211,8 +213,11 @@ void VDPVRAM::updateVRMode(bool newVRmode, EmuTime time)
 		// actually changed. So this test is not only an optimization.
 		return;
 	}
+	// A deferred command must still see the old layout.
+	cmdEngine->sync(time);
 	vrMode = newVRmode;
 	setSizeMask(time);
+	dirty.setAll();
 
 	if (vrMode) {
 		// switch from VR=0 to VR=1
@@ -234,6 +239,8 @@ void VDPVRAM::updateEVRMode(bool newEVRMode, EmuTime time)
 		// actually changed. So this test is not only an optimization.
 		return;
 	}
+	// A deferred command must still see the old layout.
+	cmdEngine->sync(time);
 	evrMode = newEVRMode;
 	setSizeMask(time);
 }
@@ -295,6 +302,11 @@ void VDPVRAM::change4k8kMapping(bool mapping8k)
 	 * even in 4K mode, all 16K of VRAM can be accessed. The only
 	 * difference is in what addresses are used to store data.
 	 */
+	remap4k8k(subspan<0x4000>(data), dirty, mapping8k);
+}
+
+void VDPVRAM::remap4k8k(std::span<uint8_t, 0x4000> vram, DirtyPages& dirtyPages, bool mapping8k)
+{
 	std::array<uint8_t, 0x4000> tmp;
 	if (mapping8k) {
 		// from 8k/16k to 4k mapping
@@ -302,7 +314,7 @@ void VDPVRAM::change4k8kMapping(bool mapping8k)
 			unsigned addr4 =  (addr8 & 0x203F) |
 			                 ((addr8 & 0x1000) >> 6) |
 			                 ((addr8 & 0x0FC0) << 1);
-			copy_to_range(subspan<64>(data, addr8),
+			copy_to_range(subspan<64>(vram, addr8),
 			              subspan<64>(tmp, addr4));
 		}
 	} else {
@@ -311,11 +323,14 @@ void VDPVRAM::change4k8kMapping(bool mapping8k)
 			unsigned addr8 =  (addr4 & 0x203F) |
 			                 ((addr4 & 0x0040) << 6) |
 			                 ((addr4 & 0x1F80) >> 1);
-			copy_to_range(subspan<64>(data, addr4),
+			copy_to_range(subspan<64>(vram, addr4),
 			              subspan<64>(tmp, addr8));
 		}
 	}
-	copy_to_range(tmp, std::span{data});
+	copy_to_range(tmp, vram);
+	// Bypasses writeCommon(), so the next reverse snapshot must still
+	// see these changes.
+	dirtyPages.set(0, 0x4000);
 }
 
 
@@ -340,7 +355,7 @@ void VDPVRAM::serialize(Archive& ar, unsigned /*version*/)
 		setSizeMask(static_cast<MSXDevice&>(vdp).getCurrentTime());
 	}
 
-	ar.serialize_blob("data", std::span{data.data(), actualSize});
+	ar.serialize_blob("data", std::span{data.data(), actualSize}, dirty);
 	ar.serialize("cmdReadWindow",       cmdReadWindow,
 	             "cmdWriteWindow",      cmdWriteWindow,
 	             "nameTable",           nameTable,
@@ -7,11 +7,14 @@
 
 #include "Ram.hh"
 #include "SimpleDebuggable.hh"
+#include "DirtyPages.hh"
 
 #include "Math.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 
 namespace openmsx {
 
@@ -313,6 +316,20 @@ public:
 		return (address & combiMask) == baseAddr;
 	}
 
+	/** Test whether any address in the range [first, last] might be
+	  * inside this window. This is a conservative test: it operates on
+	  * the smallest aligned power-of-2 sized block that contains the
+	  * range, so it can report overlap where there is none.
+	  * @param first The first address of the range.
+	  * @param last The last address of the range (inclusive).
+	  * @return false iff no address of the range is inside this window.
+	  */
+	[[nodiscard]] bool mayOverlap(unsigned first, unsigned last) const {
+		if (!isEnabled()) return false;
+		unsigned areaBits = Math::floodRight(first ^ last);
+		return (first & combiMask & ~areaBits) == (baseAddr & ~areaBits);
+	}
+
 	/** Notifies the observer of this window of a VRAM change,
 	  * if the changes address is inside this window.
 	  * @param address The address to test.
@@ -419,7 +436,7 @@ public:
 	  */
 	void sync(EmuTime time) {
 		assert(vdp.isInsideFrame(time));
-		cmdEngine->sync(time);
+		cmdEngine->syncObserved(time);
 	}
 
 	/** Write a byte from the command engine.
@@ -448,6 +465,79 @@ public:
 		writeCommon(address, value, time);
 	}
 
+	/** Can the command engine read the range [address, address + size)
+	  * directly from VRAM? This is the case when the range is not affected
+	  * by mirroring or by non-present ram chips.
+	  */
+	[[nodiscard]] bool isCmdBlockReadable(unsigned address, unsigned size) const {
+		assert(size != 0);
+		unsigned last = address + size - 1;
+		return ((last & ~sizeMask) == 0) && (last < actualSize);
+	}
+
+	/** Can the command engine write the range [address, address + size)
+	  * as a single block instead of byte per byte via cmdWrite()? On top
+	  * of the requirements of isCmdBlockReadable() this also requires that
+	  * no observed window overlaps with the range, so that skipping the
+	  * per-byte notifications makes no difference.
+	  */
+	[[nodiscard]] bool isCmdBlockWritable(unsigned address, unsigned size) const {
+		return isCmdBlockReadable(address, size) &&
+		       !isObserved(address, address + size - 1);
+	}
+
+	/** Might the given address range be looked at by the renderer or the
+	  * sprite checker? This check is conservative: it may return true
+	  * for ranges that aren't actually observed.
+	  * @param first The first address of the range.
+	  * @param last The last address of the range (inclusive).
+	  */
+	[[nodiscard]] bool isObserved(unsigned first, unsigned last) const {
+		auto observed = [&](const VRAMWindow& window) {
+			return window.hasObserver() && window.mayOverlap(first, last) &&
+			       window.observer->isObserving(first, last);
+		};
+		return observed(bitmapVisibleWindow) ||
+		       observed(spriteAttribTable) ||
+		       observed(spritePatternTable);
+	}
+
+	/** Fill a block of VRAM from the command engine.
+	  * Equivalent to calling cmdWrite() for each byte in the range, but
+	  * only allowed when isCmdBlockWritable() holds for that range.
+	  * @param time The moment of the last write in the block.
+	  */
+	void cmdFill(unsigned address, unsigned size, uint8_t value, EmuTime time) {
+		#ifdef DEBUG
+		assert(time >= vramTime);
+		vramTime = time;
+		#endif
+		(void)time;
+		assert(isCmdBlockWritable(address, size));
+		std::fill_n(&data[address], size, value);
+		dirty.set(address, size);
+	}
+
+	/** Copy a block of VRAM from the command engine.
+	  * Equivalent to reading the source and calling cmdWrite() for each
+	  * byte in the range, but only allowed when isCmdBlockReadable() holds
+	  * for the source range and isCmdBlockWritable() for the destination
+	  * range. When both ranges overlap the result is as if the whole
+	  * source was read before the destination gets written.
+	  * @param time The moment of the last write in the block.
+	  */
+	void cmdCopy(unsigned dst, unsigned src, unsigned size, EmuTime time) {
+		#ifdef DEBUG
+		assert(time >= vramTime);
+		vramTime = time;
+		#endif
+		(void)time;
+		assert(isCmdBlockReadable(src, size));
+		assert(isCmdBlockWritable(dst, size));
+		memmove(&data[dst], &data[src], size);
+		dirty.set(dst, size);
+	}
+
 	/** Write a byte to VRAM through the CPU interface.
 	  * @param address The address to write.
 	  * @param value The value to write.
@@ -569,6 +659,11 @@ public:
 	  */
 	void change4k8kMapping(bool mapping8k);
 
+	/** The actual permutation done by change4k8kMapping(). Also marks
+	  * the touched pages dirty. Static so it can be unit-tested.
+	  */
+	static void remap4k8k(std::span<uint8_t, 0x4000> vram, DirtyPages& dirtyPages, bool mapping8k);
+
 	/** Only used by debugger
 	 */
 	[[nodiscard]] std::span<const uint8_t> getData() const {
@@ -600,6 +695,7 @@ private:
 		spritePatternTable.notify(address, time);
 
 		data[address] = value;
+		dirty.set(address);
 
 		// Cache dirty marking should happen after the commit,
 		// otherwise the cache could be re-validated based on old state.
@@ -638,6 +734,10 @@ private:
 	  */
 	Ram data;
 
+	/** The pages of 'data' written since the last reverse snapshot.
+	  */
+	DirtyPages dirty;
+
 	/** Debuggable with mode dependent view on the vram
 	  *   Screen7/8 are not interleaved in this mode.
 	  *   This debuggable is also at least 128kB in size (it possibly
@@ -35,6 +35,18 @@ public:
 	  */
 	virtual void updateWindow(bool enabled, EmuTime time) = 0;
 
+	/** Might the observer look at (part of) the given VRAM range, given
+	  * its current state? If not, changes to that range need not be
+	  * reported at the exact moment they occur. This allows the command
+	  * engine to write in bulk, or to defer execution altogether.
+	  * The default implementation conservatively returns true.
+	  * @param first First address of the range.
+	  * @param last Last address of the range (inclusive).
+	  */
+	[[nodiscard]] virtual bool isObserving(unsigned /*first*/, unsigned /*last*/) const {
+		return true;
+	}
+
 protected:
 	~VRAMObserver() = default;
 };